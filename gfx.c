@@ -37,17 +37,80 @@ POSSIBILITY OF SUCH DAMAGE.
 #include <stdint.h>
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 #include "gfx.h"
-#include "font-7x12.c"
+#include "lcd.h"
 
 #define pgm_read_byte(addr) (*(const unsigned char *)(addr))
 
 struct gfx_state __gfx_state;
 
-extern void lcd_write_pixel(uint16_t, uint16_t, uint16_t);
+// While damage is being recorded (gfx_damage.c) a primitive only notes
+// the area it would have drawn on, and draws nothing. The corners are
+// worked out in 32 bits, a circle's 2*r+1 can be wider than an int16_t.
+#define GFX_DAMAGE(x, y, w, h) \
+  if (__gfx_state.damage) { \
+    gfx_damage_box((x), (y), (int32_t) (x) + (w) - 1, \
+                   (int32_t) (y) + (h) - 1); \
+    return; \
+  }
+
+// While a display list is being built (gfx_dl.c) a primitive is added
+// to the list to be drawn later, instead of being drawn now.
+#define GFX_RECORD(...) \
+  if (__gfx_state.dl) { gfx_dl_record(__VA_ARGS__); return; }
+
+// A primitive whose bounding box misses the clip rectangle returns
+// before drawing anything. What is left is clipped a span at a time
+// by gfx_fillRect(), gfx_drawLine() and the glyph window.
+#define GFX_REJECT(x, y, w, h) \
+  if (gfx_clipOut((x), (y), (w), (h))) return;
+
+static int gfx_clipOut(int32_t x, int32_t y, int32_t w, int32_t h) {
+  const struct gfx_clip *c = &__gfx_state.clip;
+
+  return (x > c->x1) || (y > c->y1) || (x + w <= c->x0) || (y + h <= c->y0);
+}
+
+#ifdef LCD_STATS
+static const char * const gfx_scope_names[GFX_SCOPES] = {
+  "other", "pixel", "line", "hline", "vline", "rect", "fill_rect",
+  "fill_screen", "circle", "fill_circle", "round_rect", "fill_round_rect",
+  "triangle", "fill_triangle", "bitmap", "char", "mesh"
+};
+
+static void
+gfx_scope_leave(int *prev) {
+  lcd_stats_leave(*prev);
+}
+
+// Count the primitive's bus cycles against scope s until it returns,
+// however it returns.
+#define GFX_SCOPE(s) \
+  int __scope __attribute__((cleanup(gfx_scope_leave))) = lcd_stats_enter(s)
+
+void
+gfx_stats_dump(void) {
+  lcd_stats_dump(gfx_scope_names, GFX_SCOPES);
+}
+#else
+#define GFX_SCOPE(s)
+#endif
 
 void
 gfx_drawPixel(uint16_t x, uint16_t y, uint16_t color) {
+    GFX_SCOPE(GFX_SCOPE_PIXEL);
+    GFX_RECORD(GFX_DL_PIXEL, x, y, color);
+    GFX_DAMAGE(x, y, 1, 1);
+    /* clipped (negative coordinates arrive here huge) */
+    if ((x < __gfx_state.clip.x0) || (x > __gfx_state.clip.x1) ||
+        (y < __gfx_state.clip.y0) || (y > __gfx_state.clip.y1)) {
+        return;
+    }
+    if (__gfx_state.tile) {
+        gfx_tile_fill(__gfx_state.tile, x, y, x, y, color);
+        return;
+    }
     lcd_write_pixel(x, y, color);
 }
 #define true 1
@@ -60,47 +123,79 @@ gfx_init()
   __gfx_state.rotation  = 0;
   __gfx_state.cursor_y  = __gfx_state.cursor_x    = 0;
   __gfx_state.textsize  = 1;
+  __gfx_state.font      = &gfx_font_7x12;
   __gfx_state.textcolor = __gfx_state.textbgcolor = 0xFFFF;
   __gfx_state.wrap      = true;
+  __gfx_state.textaa    = 0;
+  __gfx_state.charpixels = 0;
+  __gfx_state.tile      = NULL;
+  __gfx_state.damage    = 0;
+  __gfx_state.dl        = 0;
+  gfx_setRotation(0);
 }
 
-// Draw a circle outline
-void gfx_drawCircle(int16_t x0, int16_t y0, int16_t r,
-    uint16_t color) {
-  int16_t f = 1 - r;
-  int16_t ddF_x = 1;
-  int16_t ddF_y = -2 * r;
-  int16_t x = 0;
-  int16_t y = r;
+// Circle outlines are drawn as runs. While the midpoint recurrence
+// keeps y the same, x steps along a horizontal run in the octants next
+// to the top and bottom and along a vertical run in the ones next to
+// the sides, and when y moves on each run is one gfx_fillRect(). Runs
+// stop at the diagonal so no pixel is written twice. xs == 0 is the
+// first run of a whole circle, which goes across the axis in one piece.
+static void gfx_circleRuns(int16_t x0, int16_t y0, int16_t xs, int16_t xe,
+    int16_t y, uint8_t corners, uint8_t whole, uint16_t color) {
+  int16_t e = (xe > y) ? y : xe;
 
-  gfx_drawPixel(x0  , y0+r, color);
-  gfx_drawPixel(x0  , y0-r, color);
-  gfx_drawPixel(x0+r, y0  , color);
-  gfx_drawPixel(x0-r, y0  , color);
+  // A radius 1 corner, its pixels are on the axes
+  if ((y == 0) && ! whole) {
+    if (xe < xs)
+      return;
+    if (corners & 0x6)
+      gfx_fillRect(x0 + xs, y0, xe - xs + 1, 1, color);
+    if (corners & 0x9)
+      gfx_fillRect(x0 - xe, y0, xe - xs + 1, 1, color);
+    if (corners & 0xc)
+      gfx_fillRect(x0, y0 + xs, 1, xe - xs + 1, color);
+    if (corners & 0x3)
+      gfx_fillRect(x0, y0 - xe, 1, xe - xs + 1, color);
+    return;
+  }
 
-  while (x<y) {
-    if (f >= 0) {
-      y--;
-      ddF_y += 2;
-      f += ddF_y;
+  if (e >= xs) {
+    if (xs == 0) {
+      gfx_fillRect(x0 - e, y0 - y, 2*e + 1, 1, color);
+      if (y)
+        gfx_fillRect(x0 - e, y0 + y, 2*e + 1, 1, color);
+    } else {
+      if (corners & 0x2)
+        gfx_fillRect(x0 + xs, y0 - y, e - xs + 1, 1, color);
+      if (corners & 0x1)
+        gfx_fillRect(x0 - e, y0 - y, e - xs + 1, 1, color);
+      if (y && (corners & 0x4))
+        gfx_fillRect(x0 + xs, y0 + y, e - xs + 1, 1, color);
+      if (y && (corners & 0x8))
+        gfx_fillRect(x0 - e, y0 + y, e - xs + 1, 1, color);
     }
-    x++;
-    ddF_x += 2;
-    f += ddF_x;
-  
-    gfx_drawPixel(x0 + x, y0 + y, color);
-    gfx_drawPixel(x0 - x, y0 + y, color);
-    gfx_drawPixel(x0 + x, y0 - y, color);
-    gfx_drawPixel(x0 - x, y0 - y, color);
-    gfx_drawPixel(x0 + y, y0 + x, color);
-    gfx_drawPixel(x0 - y, y0 + x, color);
-    gfx_drawPixel(x0 + y, y0 - x, color);
-    gfx_drawPixel(x0 - y, y0 - x, color);
   }
+  e = (xe >= y) ? y - 1 : xe;
+  if (e < xs)
+    return;
+  if (xs == 0) {
+    gfx_fillRect(x0 + y, y0 - e, 1, 2*e + 1, color);
+    gfx_fillRect(x0 - y, y0 - e, 1, 2*e + 1, color);
+    return;
+  }
+  if (corners & 0x4)
+    gfx_fillRect(x0 + y, y0 + xs, 1, e - xs + 1, color);
+  if (corners & 0x2)
+    gfx_fillRect(x0 + y, y0 - e, 1, e - xs + 1, color);
+  if (corners & 0x8)
+    gfx_fillRect(x0 - y, y0 + xs, 1, e - xs + 1, color);
+  if (corners & 0x1)
+    gfx_fillRect(x0 - y, y0 - e, 1, e - xs + 1, color);
 }
 
-void gfx_drawCircleHelper( int16_t x0, int16_t y0,
-               int16_t r, uint8_t cornername, uint16_t color) {
+static void gfx_circleOutline(int16_t x0, int16_t y0, int16_t r,
+    uint8_t corners, uint8_t whole, uint16_t color) {
+  int16_t xs    = whole ? 0 : 1;
   int16_t f     = 1 - r;
   int16_t ddF_x = 1;
   int16_t ddF_y = -2 * r;
@@ -109,6 +204,8 @@ void gfx_drawCircleHelper( int16_t x0, int16_t y0,
 
   while (x<y) {
     if (f >= 0) {
+      gfx_circleRuns(x0, y0, xs, x, y, corners, whole, color);
+      xs = x + 1;
       y--;
       ddF_y += 2;
       f     += ddF_y;
@@ -116,43 +213,64 @@ void gfx_drawCircleHelper( int16_t x0, int16_t y0,
     x++;
     ddF_x += 2;
     f     += ddF_x;
-    if (cornername & 0x4) {
-      gfx_drawPixel(x0 + x, y0 + y, color);
-      gfx_drawPixel(x0 + y, y0 + x, color);
-    } 
-    if (cornername & 0x2) {
-      gfx_drawPixel(x0 + x, y0 - y, color);
-      gfx_drawPixel(x0 + y, y0 - x, color);
-    }
-    if (cornername & 0x8) {
-      gfx_drawPixel(x0 - y, y0 + x, color);
-      gfx_drawPixel(x0 - x, y0 + y, color);
-    }
-    if (cornername & 0x1) {
-      gfx_drawPixel(x0 - y, y0 - x, color);
-      gfx_drawPixel(x0 - x, y0 - y, color);
-    }
   }
+  gfx_circleRuns(x0, y0, xs, x, y, corners, whole, color);
 }
 
-void gfx_fillCircle(int16_t x0, int16_t y0, int16_t r,
-			      uint16_t color) {
-  gfx_drawFastVLine(x0, y0-r, 2*r+1, color);
-  gfx_fillCircleHelper(x0, y0, r, 3, 0, color);
+// Draw a circle outline
+void gfx_drawCircle(int16_t x0, int16_t y0, int16_t r,
+    uint16_t color) {
+  GFX_SCOPE(GFX_SCOPE_CIRCLE);
+  GFX_RECORD(GFX_DL_CIRCLE, x0, y0, r, color);
+  GFX_DAMAGE(x0-r, y0-r, 2*r+1, 2*r+1);
+  GFX_REJECT(x0-r, y0-r, 2*r+1, 2*r+1);
+  gfx_circleOutline(x0, y0, r, 0xf, 1, color);
 }
 
-// Used to do circles and roundrects
-void gfx_fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
-    uint8_t cornername, int16_t delta, uint16_t color) {
+void gfx_drawCircleHelper( int16_t x0, int16_t y0,
+               int16_t r, uint8_t cornername, uint16_t color) {
+  GFX_SCOPE(GFX_SCOPE_CIRCLE);
+  GFX_RECORD(GFX_DL_CIRCLE_HELPER, x0, y0, r, cornername, color);
+  GFX_DAMAGE(x0-r, y0-r, 2*r+1, 2*r+1);
+  GFX_REJECT(x0-r, y0-r, 2*r+1, 2*r+1);
+  gfx_circleOutline(x0, y0, r, cornername, 0, color);
+}
 
+// One row (or, for the middle, h rows) of a filled circle hw either
+// side of x0: the whole width, or just the right (0x1) or left (0x2)
+// half without the middle column.
+static void gfx_circleSpan(int16_t x0, int16_t y, int16_t hw, int16_t h,
+    uint8_t corners, uint8_t whole, uint16_t color) {
+  if (whole) {
+    gfx_fillRect(x0 - hw, y, 2*hw + 1, h, color);
+    return;
+  }
+  if (corners & 0x1)
+    gfx_fillRect(x0 + 1, y, hw, h, color);
+  if (corners & 0x2)
+    gfx_fillRect(x0 - hw, y, hw, h, color);
+}
+
+// Filled circles are horizontal spans, one window burst each. The
+// recurrence gives every row its half width exactly once: the rows
+// near the middle (y0 +- x) as x steps, the ones near the top and
+// bottom (y0 +- y) when y is about to move on. The bottom half is
+// drawn delta rows lower and the rows in between get the middle span.
+static void gfx_circleFill(int16_t x0, int16_t y0, int16_t r,
+    uint8_t corners, uint8_t whole, int16_t delta, uint16_t color) {
   int16_t f     = 1 - r;
   int16_t ddF_x = 1;
   int16_t ddF_y = -2 * r;
   int16_t x     = 0;
   int16_t y     = r;
 
+  gfx_circleSpan(x0, y0, r, delta + 1, corners, whole, color);
   while (x<y) {
     if (f >= 0) {
+      if (y > x + 1) {
+        gfx_circleSpan(x0, y0 - y, x, 1, corners, whole, color);
+        gfx_circleSpan(x0, y0 + y + delta, x, 1, corners, whole, color);
+      }
       y--;
       ddF_y += 2;
       f     += ddF_y;
@@ -160,22 +278,79 @@ void gfx_fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
     x++;
     ddF_x += 2;
     f     += ddF_x;
-
-    if (cornername & 0x1) {
-      gfx_drawFastVLine(x0+x, y0-y, 2*y+1+delta, color);
-      gfx_drawFastVLine(x0+y, y0-x, 2*x+1+delta, color);
-    }
-    if (cornername & 0x2) {
-      gfx_drawFastVLine(x0-x, y0-y, 2*y+1+delta, color);
-      gfx_drawFastVLine(x0-y, y0-x, 2*x+1+delta, color);
-    }
+    gfx_circleSpan(x0, y0 - x, y, 1, corners, whole, color);
+    gfx_circleSpan(x0, y0 + x + delta, y, 1, corners, whole, color);
   }
 }
 
-// Bresenham's algorithm - thx wikpedia
+void gfx_fillCircle(int16_t x0, int16_t y0, int16_t r,
+			      uint16_t color) {
+  GFX_SCOPE(GFX_SCOPE_FILL_CIRCLE);
+  GFX_RECORD(GFX_DL_FILL_CIRCLE, x0, y0, r, color);
+  GFX_DAMAGE(x0-r, y0-r, 2*r+1, 2*r+1);
+  GFX_REJECT(x0-r, y0-r, 2*r+1, 2*r+1);
+  gfx_circleFill(x0, y0, r, 3, 1, 0, color);
+}
+
+// Used to do circles and roundrects
+void gfx_fillCircleHelper(int16_t x0, int16_t y0, int16_t r,
+    uint8_t cornername, int16_t delta, uint16_t color) {
+
+  GFX_SCOPE(GFX_SCOPE_FILL_CIRCLE);
+  GFX_RECORD(GFX_DL_FILL_CIRCLE_HELPER, x0, y0, r, cornername, delta, color);
+  GFX_DAMAGE(x0-r, y0-r, 2*r+1, 2*r+1+delta);
+  GFX_REJECT(x0-r, y0-r, 2*r+1, 2*r+1+delta);
+  gfx_circleFill(x0, y0, r, cornername, 0, delta, color);
+}
+
+// Where x, y is in relation to the clip rectangle, the
+// Cohen-Sutherland way: a bit for each edge it is past.
+#define GFX_OUT_LEFT    0x1
+#define GFX_OUT_RIGHT   0x2
+#define GFX_OUT_TOP     0x4
+#define GFX_OUT_BOTTOM  0x8
+
+static uint8_t gfx_outcode(int16_t x, int16_t y) {
+  uint8_t code = 0;
+
+  if (x < __gfx_state.clip.x0)
+    code |= GFX_OUT_LEFT;
+  else if (x > __gfx_state.clip.x1)
+    code |= GFX_OUT_RIGHT;
+  if (y < __gfx_state.clip.y0)
+    code |= GFX_OUT_TOP;
+  else if (y > __gfx_state.clip.y1)
+    code |= GFX_OUT_BOTTOM;
+  return code;
+}
+
+// Bresenham's algorithm - thx wikpedia - but drawn a run at a time.
+// Along the long axis the line is runs of pixels on the same row (or
+// column, if it is steep), and each run is one gfx_fillRect() burst
+// instead of a window per pixel. Where run k ends comes straight from
+// the error term, (dx/2 + k*dx) / dy, and the next run's end is that
+// plus dx/dy with the remainder carried, so there is no per pixel loop.
+//
+// The outcodes throw away lines wholly off one side of the clip
+// rectangle and let lines wholly inside it through untouched. The rest
+// are clipped to the steps of the long axis that land inside. That is
+// done in steps
+// rather than by moving the end points to the edges so the pixels that
+// are left are exactly the ones the whole line would have drawn.
 void gfx_drawLine(int16_t x0, int16_t y0,
 			    int16_t x1, int16_t y1,
 			    uint16_t color) {
+  GFX_SCOPE(GFX_SCOPE_LINE);
+  GFX_RECORD(GFX_DL_LINE, x0, y0, x1, y1, color);
+  if (__gfx_state.damage) {
+    gfx_damage_line(x0, y0, x1, y1);
+    return;
+  }
+  uint8_t c0 = gfx_outcode(x0, y0);
+  uint8_t c1 = gfx_outcode(x1, y1);
+  if (c0 & c1)
+    return;
+
   int16_t steep = abs(y1 - y0) > abs(x1 - x0);
   if (steep) {
     swap(x0, y0);
@@ -187,29 +362,67 @@ void gfx_drawLine(int16_t x0, int16_t y0,
     swap(y0, y1);
   }
 
-  int16_t dx, dy;
-  dx = x1 - x0;
-  dy = abs(y1 - y0);
+  uint32_t dx = (int32_t) x1 - x0;
+  uint32_t dy = abs((int32_t) y1 - y0);
+  int16_t ystep = (y0 < y1) ? 1 : -1;
 
-  int16_t err = dx / 2;
-  int16_t ystep;
+  // Steps ia to ib of the long axis are drawn
+  int32_t ia = 0, ib = dx;
+  if (c0 | c1) {
+    const struct gfx_clip *c = &__gfx_state.clip;
+    int32_t xlo = steep ? c->y0 : c->x0, xhi = steep ? c->y1 : c->x1;
+    int32_t ylo = steep ? c->x0 : c->y0, yhi = steep ? c->x1 : c->y1;
+    // the range of k, the number of ysteps taken, that is inside
+    int32_t klo = (ystep > 0) ? ylo - y0 : y0 - yhi;
+    int32_t khi = (ystep > 0) ? yhi - y0 : y0 - ylo;
 
-  if (y0 < y1) {
-    ystep = 1;
-  } else {
-    ystep = -1;
+    if (x0 < xlo)
+      ia = xlo - x0;
+    if (x1 > xhi)
+      ib = xhi - x0;
+    if ((khi < 0) || (klo > (int32_t) dy))
+      return;
+    // the first step with k >= klo and the last one with k <= khi
+    if (klo > 0) {
+      int32_t i = (dx / 2 + (klo - 1) * dx) / dy + 1;
+      if (i > ia)
+        ia = i;
+    }
+    if (khi < (int32_t) dy) {
+      int32_t i = (dx / 2 + khi * dx) / dy;
+      if (i < ib)
+        ib = i;
+    }
+    if (ia > ib)
+      return;
+  }
+
+  // k at step ia, and where that run ends (q, with remainder r)
+  uint32_t k = 0, q = ib, r = 0;
+  if (ia * dy > dx / 2)
+    k = (ia * dy - dx / 2 + dx - 1) / dx;
+  if (dy) {
+    q = (dx / 2 + k * dx) / dy;
+    r = (dx / 2 + k * dx) % dy;
   }
 
-  for (; x0<=x1; x0++) {
+  for (;;) {
+    int32_t e = (q < (uint32_t) ib) ? (int32_t) q : ib;
+    int16_t y = y0 + ystep * (int32_t) k;
     if (steep) {
-      gfx_drawPixel(y0, x0, color);
+      gfx_fillRect(y, x0 + ia, 1, e - ia + 1, color);
     } else {
-      gfx_drawPixel(x0, y0, color);
+      gfx_fillRect(x0 + ia, y, e - ia + 1, 1, color);
     }
-    err -= dy;
-    if (err < 0) {
-      y0 += ystep;
-      err += dx;
+    if (e >= ib)
+      break;
+    ia = e + 1;
+    k++;
+    q += dx / dy;
+    r += dx % dy;
+    if (r >= dy) {
+      q++;
+      r -= dy;
     }
   }
 }
@@ -218,6 +431,10 @@ void gfx_drawLine(int16_t x0, int16_t y0,
 void gfx_drawRect(int16_t x, int16_t y,
 			    int16_t w, int16_t h,
 			    uint16_t color) {
+  GFX_SCOPE(GFX_SCOPE_RECT);
+  GFX_RECORD(GFX_DL_RECT, x, y, w, h, color);
+  GFX_DAMAGE(x, y, w, h);
+  GFX_REJECT(x, y, w, h);
   gfx_drawFastHLine(x, y, w, color);
   gfx_drawFastHLine(x, y+h-1, w, color);
   gfx_drawFastVLine(x, y, h, color);
@@ -226,32 +443,71 @@ void gfx_drawRect(int16_t x, int16_t y,
 
 void gfx_drawFastVLine(int16_t x, int16_t y,
 				 int16_t h, uint16_t color) {
-  // Update in subclasses if desired!
-  gfx_drawLine(x, y, x, y+h-1, color);
+  GFX_SCOPE(GFX_SCOPE_VLINE);
+  GFX_RECORD(GFX_DL_FILL_RECT, x, y, 1, h, color);
+  GFX_DAMAGE(x, y, 1, h);
+  // A one column window, the controller walks down it by itself
+  gfx_fillRect(x, y, 1, h, color);
 }
 
 void gfx_drawFastHLine(int16_t x, int16_t y,
 				 int16_t w, uint16_t color) {
-  // Update in subclasses if desired!
-  gfx_drawLine(x, y, x+w-1, y, color);
+  GFX_SCOPE(GFX_SCOPE_HLINE);
+  GFX_RECORD(GFX_DL_FILL_RECT, x, y, w, 1, color);
+  GFX_DAMAGE(x, y, w, 1);
+  gfx_fillRect(x, y, w, 1, color);
 }
 
+// Clip, then it is one GRAM window and a single burst
+// of the same color, no per pixel addressing at all. A single line
+// doesn't need a window of its own, lcd_fill_line() just points the
+// address counter at it.
 void gfx_fillRect(int16_t x, int16_t y, int16_t w, int16_t h,
 			    uint16_t color) {
-  // Update in subclasses if desired!
-  int16_t i;
-  for (i=x; i<x+w; i++) {
-    gfx_drawFastVLine(i, y, h, color);
+  GFX_SCOPE(GFX_SCOPE_FILL_RECT);
+  GFX_RECORD(GFX_DL_FILL_RECT, x, y, w, h, color);
+  GFX_DAMAGE(x, y, w, h);
+  const struct gfx_clip *c = &__gfx_state.clip;
+  int32_t x1 = (int32_t) x + w - 1;
+  int32_t y1 = (int32_t) y + h - 1;
+
+  if (x < c->x0) x = c->x0;
+  if (y < c->y0) y = c->y0;
+  if (x1 > c->x1) x1 = c->x1;
+  if (y1 > c->y1) y1 = c->y1;
+  if ((x > x1) || (y > y1))
+    return;
+
+  if (__gfx_state.tile) {
+    gfx_tile_fill(__gfx_state.tile, x, y, x1, y1, color);
+    return;
+  }
+  if (y == y1) {
+    lcd_fill_line(x, y, x1 - x + 1, LCD_SCAN_H, color);
+    return;
   }
+  if (x == x1) {
+    lcd_fill_line(x, y, y1 - y + 1, LCD_SCAN_V, color);
+    return;
+  }
+  lcd_set_window(x, y, x1, y1);
+  lcd_fill_pixels(color, (uint32_t) (x1 - x + 1) * (y1 - y + 1));
 }
 
 void gfx_fillScreen(uint16_t color) {
+  GFX_SCOPE(GFX_SCOPE_FILL_SCREEN);
+  GFX_RECORD(GFX_DL_FILL_RECT, 0, 0, __gfx_state._width, __gfx_state._height, color);
+  GFX_DAMAGE(0, 0, __gfx_state._width, __gfx_state._height);
   gfx_fillRect(0, 0, __gfx_state._width, __gfx_state._height, color);
 }
 
 // Draw a rounded rectangle
 void gfx_drawRoundRect(int16_t x, int16_t y, int16_t w,
   int16_t h, int16_t r, uint16_t color) {
+  GFX_SCOPE(GFX_SCOPE_ROUND_RECT);
+  GFX_RECORD(GFX_DL_ROUND_RECT, x, y, w, h, r, color);
+  GFX_DAMAGE(x, y, w, h);
+  GFX_REJECT(x, y, w, h);
   // smarter version
   gfx_drawFastHLine(x+r  , y    , w-2*r, color); // Top
   gfx_drawFastHLine(x+r  , y+h-1, w-2*r, color); // Bottom
@@ -267,6 +523,10 @@ void gfx_drawRoundRect(int16_t x, int16_t y, int16_t w,
 // Fill a rounded rectangle
 void gfx_fillRoundRect(int16_t x, int16_t y, int16_t w,
 				 int16_t h, int16_t r, uint16_t color) {
+  GFX_SCOPE(GFX_SCOPE_FILL_ROUND_RECT);
+  GFX_RECORD(GFX_DL_FILL_ROUND_RECT, x, y, w, h, r, color);
+  GFX_DAMAGE(x, y, w, h);
+  GFX_REJECT(x, y, w, h);
   // smarter version
   gfx_fillRect(x+r, y, w-2*r, h, color);
 
@@ -275,21 +535,121 @@ void gfx_fillRoundRect(int16_t x, int16_t y, int16_t w,
   gfx_fillCircleHelper(x+r    , y+r, r, 2, h-2*r-1, color);
 }
 
+// A triangle's bounding box (inclusive)
+static void gfx_triangleBox(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+    int16_t x2, int16_t y2, int32_t *xa, int32_t *ya, int32_t *xb,
+    int32_t *yb) {
+  *xa = *xb = x0;
+  *ya = *yb = y0;
+  if (x1 < *xa) *xa = x1; else if (x1 > *xb) *xb = x1;
+  if (x2 < *xa) *xa = x2; else if (x2 > *xb) *xb = x2;
+  if (y1 < *ya) *ya = y1; else if (y1 > *yb) *yb = y1;
+  if (y2 < *ya) *ya = y2; else if (y2 > *yb) *yb = y2;
+}
+
+// Is the triangle's bounding box outside the clip rectangle?
+static int gfx_triangleOut(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+    int16_t x2, int16_t y2) {
+  int32_t xa, ya, xb, yb;
+
+  gfx_triangleBox(x0, y0, x1, y1, x2, y2, &xa, &ya, &xb, &yb);
+  return gfx_clipOut(xa, ya, xb - xa + 1, yb - ya + 1);
+}
+
+// While recording damage a triangle marks its bounding box, all three
+// edges and everything between them
+static int gfx_triangleDamage(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+    int16_t x2, int16_t y2) {
+  int32_t xa, ya, xb, yb;
+
+  if (! __gfx_state.damage)
+    return 0;
+  gfx_triangleBox(x0, y0, x1, y1, x2, y2, &xa, &ya, &xb, &yb);
+  gfx_damage_box(xa, ya, xb, yb);
+  return 1;
+}
+
 // Draw a triangle
 void gfx_drawTriangle(int16_t x0, int16_t y0,
 				int16_t x1, int16_t y1,
 				int16_t x2, int16_t y2, uint16_t color) {
+  GFX_SCOPE(GFX_SCOPE_TRIANGLE);
+  GFX_RECORD(GFX_DL_TRIANGLE, x0, y0, x1, y1, x2, y2, color);
+  if (gfx_triangleDamage(x0, y0, x1, y1, x2, y2))
+    return;
+  if (gfx_triangleOut(x0, y0, x1, y1, x2, y2))
+    return;
   gfx_drawLine(x0, y0, x1, y1, color);
   gfx_drawLine(x1, y1, x2, y2, color);
   gfx_drawLine(x2, y2, x0, y0, color);
 }
 
+// A triangle edge stepped down the rows from (xa, ya) to (xb, yb):
+// t rows down x is xa + floor((dx * t + c) / dy), with c picking the
+// rounding. The quotient and remainder of dx / dy are found once in
+// gfx_edgeInit() and each row after that is an add and a compare, no
+// divisions, and the answer is exact for any pair of int16_t points.
+struct gfx_edge {
+  int32_t x, q, r, e, dy;
+};
+
+static void gfx_edgeInit(struct gfx_edge *g, int16_t xa, int16_t ya,
+                         int16_t xb, int16_t yb, int16_t y, int32_t c) {
+  int32_t dx = xb - xa;
+  int64_t n, f;
+
+  g->dy = yb - ya;
+  g->q = dx / g->dy;
+  g->r = dx % g->dy;
+  if (g->r < 0) {
+    g->q--;
+    g->r += g->dy;
+  }
+  // start part way down when the top rows are clipped off
+  n = (int64_t) dx * (y - ya) + c;
+  f = n / g->dy;
+  if ((f * g->dy) > n)
+    f--;
+  g->x = xa + (int32_t) f;
+  g->e = (int32_t) (n - f * g->dy);
+}
+
+static inline void gfx_edgeStep(struct gfx_edge *g) {
+  g->x += g->q;
+  g->e += g->r;
+  if (g->e >= g->dy) {
+    g->e -= g->dy;
+    g->x++;
+  }
+}
+
+// gfx_fillTriangle() rounds toward the top of the edge, the way C's
+// integer division truncates: up for an edge leaning left, down for one
+// leaning right
+#define GFX_EDGE_TRUNC(xa, xb, dy)  (((xb) < (xa)) ? (dy) - 1 : 0)
+
+// Pixels a to b of row y, cut to the clip here where they are still
+// 32 bits wide (a huge triangle's span doesn't fit gfx_fillRect()'s w)
+static void gfx_span(int32_t a, int32_t b, int16_t y, uint16_t color) {
+  if (a < __gfx_state.clip.x0) a = __gfx_state.clip.x0;
+  if (b > __gfx_state.clip.x1) b = __gfx_state.clip.x1;
+  if (a <= b)
+    gfx_fillRect(a, y, b - a + 1, 1, color);
+}
+
 // Fill a triangle
 void gfx_fillTriangle ( int16_t x0, int16_t y0,
 				  int16_t x1, int16_t y1,
 				  int16_t x2, int16_t y2, uint16_t color) {
 
-  int16_t a, b, y, last;
+  GFX_SCOPE(GFX_SCOPE_FILL_TRIANGLE);
+  GFX_RECORD(GFX_DL_FILL_TRIANGLE, x0, y0, x1, y1, x2, y2, color);
+  if (gfx_triangleDamage(x0, y0, x1, y1, x2, y2))
+    return;
+  if (gfx_triangleOut(x0, y0, x1, y1, x2, y2))
+    return;
+  int16_t a, b, y, last, ye;
+  struct gfx_edge ea, eb;
 
   // Sort coordinates by Y order (y2 >= y1 >= y0)
   if (y0 > y1) {
@@ -308,88 +668,312 @@ void gfx_fillTriangle ( int16_t x0, int16_t y0,
     else if(x1 > b) b = x1;
     if(x2 < a)      a = x2;
     else if(x2 > b) b = x2;
-    gfx_drawFastHLine(a, y0, b-a+1, color);
+    gfx_fillRect(a, y0, b-a+1, 1, color);
     return;
   }
 
-  int16_t
-    dx01 = x1 - x0,
-    dy01 = y1 - y0,
-    dx02 = x2 - x0,
-    dy02 = y2 - y0,
-    dx12 = x2 - x1,
-    dy12 = y2 - y1,
-    sa   = 0,
-    sb   = 0;
+  // Only the rows inside the clip are walked, the edges start at the
+  // first of them. Each row is one span straight to gfx_fillRect().
+  y  = (y0 < __gfx_state.clip.y0) ? __gfx_state.clip.y0 : y0;
+  ye = (y2 > __gfx_state.clip.y1) ? __gfx_state.clip.y1 : y2;
+  gfx_edgeInit(&eb, x0, y0, x2, y2, y, GFX_EDGE_TRUNC(x0, x2, y2 - y0));
 
   // For upper part of triangle, find scanline crossings for segments
   // 0-1 and 0-2.  If y1=y2 (flat-bottomed triangle), the scanline y1
-  // is included here (and second loop will be skipped, avoiding a /0
-  // error there), otherwise scanline y1 is skipped here and handled
-  // in the second loop...which also avoids a /0 error here if y0=y1
-  // (flat-topped triangle).
+  // is included here (and second loop will be skipped), otherwise
+  // scanline y1 is skipped here and handled in the second loop, which
+  // also skips this one if y0=y1 (flat-topped triangle).
   if(y1 == y2) last = y1;   // Include y1 scanline
   else         last = y1-1; // Skip it
+  if (last > ye)
+    last = ye;
 
-  for(y=y0; y<=last; y++) {
-    a   = x0 + sa / dy01;
-    b   = x0 + sb / dy02;
-    sa += dx01;
-    sb += dx02;
-    /* longhand:
-    a = x0 + (x1 - x0) * (y - y0) / (y1 - y0);
-    b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
-    */
-    if(a > b) swap(a,b);
-    gfx_drawFastHLine(a, y, b-a+1, color);
+  if (y <= last) {
+    gfx_edgeInit(&ea, x0, y0, x1, y1, y, GFX_EDGE_TRUNC(x0, x1, y1 - y0));
+    for(; y<=last; y++) {
+      if (ea.x < eb.x) gfx_span(ea.x, eb.x, y, color);
+      else             gfx_span(eb.x, ea.x, y, color);
+      gfx_edgeStep(&ea);
+      gfx_edgeStep(&eb);
+    }
   }
 
   // For lower part of triangle, find scanline crossings for segments
   // 0-2 and 1-2.  This loop is skipped if y1=y2.
-  sa = dx12 * (y - y1);
-  sb = dx02 * (y - y0);
-  for(; y<=y2; y++) {
-    a   = x1 + sa / dy12;
-    b   = x0 + sb / dy02;
-    sa += dx12;
-    sb += dx02;
-    /* longhand:
-    a = x1 + (x2 - x1) * (y - y1) / (y2 - y1);
-    b = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
-    */
-    if(a > b) swap(a,b);
-    gfx_drawFastHLine(a, y, b-a+1, color);
+  if (y > ye)
+    return;
+  gfx_edgeInit(&ea, x1, y1, x2, y2, y, GFX_EDGE_TRUNC(x1, x2, y2 - y1));
+  for(; y<=ye; y++) {
+    if (ea.x < eb.x) gfx_span(ea.x, eb.x, y, color);
+    else             gfx_span(eb.x, ea.x, y, color);
+    gfx_edgeStep(&ea);
+    gfx_edgeStep(&eb);
+  }
+}
+
+// One triangle of a mesh. A pixel is drawn when its center is inside,
+// or on an edge that is a left edge or a flat top: rows run from y0 to
+// y2 - 1 and a row covers ceil(left) to ceil(right) - 1, so of two
+// triangles sharing an edge exactly one draws each pixel along it.
+static void gfx_meshTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
+                             int16_t x2, int16_t y2, uint16_t color) {
+  struct gfx_edge el, es;
+  int64_t cross;
+  int16_t y, ye;
+
+  if (y0 > y1) {
+    swap(y0, y1); swap(x0, x1);
+  }
+  if (y1 > y2) {
+    swap(y2, y1); swap(x2, x1);
+  }
+  if (y0 > y1) {
+    swap(y0, y1); swap(x0, x1);
+  }
+  // which side of the long edge 0-2 the other vertex is on, none for
+  // a triangle with no area (which covers nothing)
+  cross = (int64_t) (x1 - x0) * (y2 - y0) - (int64_t) (x2 - x0) * (y1 - y0);
+  if (cross == 0)
+    return;
+
+  y  = (y0 < __gfx_state.clip.y0) ? __gfx_state.clip.y0 : y0;
+  ye = (y2 - 1 > __gfx_state.clip.y1) ? __gfx_state.clip.y1 : y2 - 1;
+  if (y > ye)
+    return;
+  gfx_edgeInit(&el, x0, y0, x2, y2, y, y2 - y0 - 1);
+  if (y < y1) {
+    gfx_edgeInit(&es, x0, y0, x1, y1, y, y1 - y0 - 1);
+    for (; (y < y1) && (y <= ye); y++) {
+      if (cross > 0) gfx_span(el.x, es.x - 1, y, color);
+      else           gfx_span(es.x, el.x - 1, y, color);
+      gfx_edgeStep(&el);
+      gfx_edgeStep(&es);
+    }
+  }
+  if (y > ye)
+    return;
+  gfx_edgeInit(&es, x1, y1, x2, y2, y, y2 - y1 - 1);
+  for (; y <= ye; y++) {
+    if (cross > 0) gfx_span(el.x, es.x - 1, y, color);
+    else           gfx_span(es.x, el.x - 1, y, color);
+    gfx_edgeStep(&el);
+    gfx_edgeStep(&es);
+  }
+}
+
+static inline const struct gfx_vertex *
+gfx_meshVertex(const struct gfx_mesh *m, uint16_t i) {
+  return &m->v[m->index ? m->index[i] : i];
+}
+
+// Fill a triangle mesh (see gfx.h). The bounding box is found once for
+// the whole mesh and cut to the clip in 32 bits, since a mesh can be
+// wider than an int16_t. That is what gets recorded or marked as
+// damage, then each triangle that reaches the clip is filled.
+void gfx_fillMesh(const struct gfx_mesh *m, uint16_t color) {
+  const struct gfx_vertex *a, *b, *c;
+  int32_t xa, ya, xb, yb;
+  uint16_t i;
+
+  GFX_SCOPE(GFX_SCOPE_MESH);
+  if (m->count < 3)
+    return;
+  a = gfx_meshVertex(m, 0);
+  xa = xb = a->x;
+  ya = yb = a->y;
+  for (i = 1; i < m->count; i++) {
+    a = gfx_meshVertex(m, i);
+    if (a->x < xa) xa = a->x; else if (a->x > xb) xb = a->x;
+    if (a->y < ya) ya = a->y; else if (a->y > yb) yb = a->y;
   }
+  GFX_REJECT(xa, ya, xb - xa + 1, yb - ya + 1);
+  if (xa < __gfx_state.clip.x0) xa = __gfx_state.clip.x0;
+  if (ya < __gfx_state.clip.y0) ya = __gfx_state.clip.y0;
+  if (xb > __gfx_state.clip.x1) xb = __gfx_state.clip.x1;
+  if (yb > __gfx_state.clip.y1) yb = __gfx_state.clip.y1;
+  GFX_RECORD(GFX_DL_MESH, xa, ya, xb - xa + 1, yb - ya + 1, color, m);
+  GFX_DAMAGE(xa, ya, xb - xa + 1, yb - ya + 1);
+
+  for (i = 2; i < m->count; i++) {
+    switch (m->mode) {
+      case GFX_MESH_TRIANGLES:
+        if ((i % 3) != 2)
+          continue;
+        a = gfx_meshVertex(m, i - 2);
+        break;
+      case GFX_MESH_STRIP:
+        a = gfx_meshVertex(m, i - 2);
+        break;
+      case GFX_MESH_FAN:
+      default:
+        a = gfx_meshVertex(m, 0);
+        break;
+    }
+    b = gfx_meshVertex(m, i - 1);
+    c = gfx_meshVertex(m, i);
+    if (gfx_triangleOut(a->x, a->y, b->x, b->y, c->x, c->y))
+      continue;
+    gfx_meshTriangle(a->x, a->y, b->x, b->y, c->x, c->y, color);
+  }
+}
+
+// The part of the w x h box at x, y that is inside the clip, as
+// inclusive corners. Returns 0 if there isn't any.
+static int gfx_clipBox(int16_t x, int16_t y, int16_t w, int16_t h,
+                       int32_t *x0, int32_t *y0, int32_t *x1, int32_t *y1) {
+  *x0 = (x < __gfx_state.clip.x0) ? __gfx_state.clip.x0 : x;
+  *y0 = (y < __gfx_state.clip.y0) ? __gfx_state.clip.y0 : y;
+  *x1 = (int32_t) x + w - 1;
+  *y1 = (int32_t) y + h - 1;
+  if (*x1 > __gfx_state.clip.x1) *x1 = __gfx_state.clip.x1;
+  if (*y1 > __gfx_state.clip.y1) *y1 = __gfx_state.clip.y1;
+  return (*x0 <= *x1) && (*y0 <= *y1);
 }
 
+// Draw a 1 bit a pixel bitmap (bit 7 on the left, (w + 7) / 8 bytes a
+// row), the set bits in color and the rest left alone. Each row is
+// drawn as its runs of set bits.
 void gfx_drawBitmap(int16_t x, int16_t y,
 			      const uint8_t *bitmap, int16_t w, int16_t h,
 			      uint16_t color) {
 
-  int16_t i, j, byteWidth = (w + 7) / 8;
+  GFX_SCOPE(GFX_SCOPE_BITMAP);
+  GFX_RECORD(GFX_DL_BITMAP, x, y, w, h, color, bitmap);
+  GFX_DAMAGE(x, y, w, h);
+  GFX_REJECT(x, y, w, h);
+  int16_t i, j, n, byteWidth = (w + 7) / 8;
+  int32_t x0, y0, x1, y1;
+  const uint8_t *row;
+
+  // only the rows and columns inside the clip rectangle
+  if (! gfx_clipBox(x, y, w, h, &x0, &y0, &x1, &y1))
+    return;
+  for(j=y0-y; j<=y1-y; j++) {
+    row = bitmap + j * byteWidth;
+    for(i=x0-x; i<=x1-x; i+=n) {
+      for (n = 0; (i + n <= x1 - x) &&
+             (pgm_read_byte(row + (i + n) / 8) & (128 >> ((i + n) & 7))); n++)
+        ;
+      if (n) {
+        gfx_fillRect(x+i, y+j, n, 1, color);
+      } else {
+        n = 1;
+      }
+    }
+  }
+}
+
+// Bitmaps go to the panel (or a tile) in bursts of up to this many
+// pixels
+#define GFX_BLIT_BURST  64
 
-  for(j=0; j<h; j++) {
-    for(i=0; i<w; i++ ) {
-      if(pgm_read_byte(bitmap + j * byteWidth + i / 8) & (128 >> (i & 7))) {
-	gfx_drawPixel(x+i, y+j, color);
+// Draw a w x h RGB565 image. stride is how many pixels apart its rows
+// are, so bitmap can point at a piece of a bigger image (0 means the
+// rows are packed, w apart). What's inside the clip is one window and
+// one stream of pixels straight from the source, nothing is copied.
+void gfx_drawRGBBitmap(int16_t x, int16_t y, const uint16_t *bitmap,
+			    int16_t w, int16_t h, int16_t stride) {
+
+  GFX_SCOPE(GFX_SCOPE_BITMAP);
+  GFX_RECORD(GFX_DL_RGB_BITMAP, x, y, w, h, stride, bitmap);
+  GFX_DAMAGE(x, y, w, h);
+  GFX_REJECT(x, y, w, h);
+  int32_t x0, y0, x1, y1, j;
+  const uint16_t *src;
+
+  if (! gfx_clipBox(x, y, w, h, &x0, &y0, &x1, &y1))
+    return;
+  if (stride == 0)
+    stride = w;
+  src = bitmap + (y0 - y) * stride + (x0 - x);
+  if (__gfx_state.tile) {
+    gfx_tile_write(__gfx_state.tile, x0, y0, x1, y1, src, stride);
+    return;
+  }
+  lcd_set_scan(LCD_SCAN_H);
+  lcd_set_window(x0, y0, x1, y1);
+  if ((x1 - x0 + 1) == stride) {
+    lcd_write_pixels(src, (uint32_t) stride * (y1 - y0 + 1));
+    return;
+  }
+  // the window wraps from one row to the next by itself
+  for (j = y0; j <= y1; j++, src += stride)
+    lcd_write_pixels(src, x1 - x0 + 1);
+}
+
+// Draw a 1 bit a pixel bitmap opaque, set bits in color and clear ones
+// in bg. The bitmap's rows are stride bytes apart (0 means packed,
+// (sx + w + 7) / 8) and the w columns drawn start at column sx, so a
+// piece of a bigger bitmap can be drawn. Rows are widened into colors
+// a burst at a time and streamed into one window.
+void gfx_drawBitmapOpaque(int16_t x, int16_t y, const uint8_t *bitmap,
+			       int16_t w, int16_t h, uint16_t color, uint16_t bg,
+			       int16_t sx, int16_t stride) {
+
+  GFX_SCOPE(GFX_SCOPE_BITMAP);
+  GFX_RECORD(GFX_DL_BITMAP_OPAQUE, x, y, w, h, color, bg, sx, stride,
+             bitmap);
+  GFX_DAMAGE(x, y, w, h);
+  GFX_REJECT(x, y, w, h);
+  uint16_t buf[GFX_BLIT_BURST];
+  int32_t x0, y0, x1, y1, j, px, k, n;
+  const uint8_t *row, *p;
+  uint8_t m;
+
+  if (! gfx_clipBox(x, y, w, h, &x0, &y0, &x1, &y1))
+    return;
+  if (stride == 0)
+    stride = (sx + w + 7) / 8;
+  if (! __gfx_state.tile) {
+    lcd_set_scan(LCD_SCAN_H);
+    lcd_set_window(x0, y0, x1, y1);
+  }
+  for (j = y0; j <= y1; j++) {
+    row = bitmap + (j - y) * stride;
+    for (px = x0; px <= x1; px += n) {
+      n = x1 - px + 1;
+      if (n > GFX_BLIT_BURST)
+        n = GFX_BLIT_BURST;
+      k = sx + (px - x);
+      p = row + k / 8;
+      m = 0x80 >> (k & 7);
+      for (k = 0; k < n; k++) {
+        buf[k] = (pgm_read_byte(p) & m) ? color : bg;
+        m >>= 1;
+        if (m == 0) {
+          m = 0x80;
+          p++;
+        }
       }
+      if (__gfx_state.tile)
+        gfx_tile_write(__gfx_state.tile, px, j, px + n - 1, j, buf, n);
+      else
+        lcd_write_pixels(buf, n);
     }
   }
 }
 
 void gfx_write(uint8_t c) {
+  uint8_t w = __gfx_state.font->width;
+  uint8_t h = __gfx_state.font->height;
+
   if (c == '\n') {
-    __gfx_state.cursor_y += __gfx_state.textsize*12;
+    __gfx_state.cursor_y += __gfx_state.textsize*h;
     __gfx_state.cursor_x  = 0;
   } else if (c == '\r') {
     // skip em
   } else {
-    gfx_drawChar(__gfx_state.cursor_x, __gfx_state.cursor_y, 
+    if (__gfx_state.textaa)
+      gfx_drawCharAA(__gfx_state.cursor_x, __gfx_state.cursor_y,
+                     c, __gfx_state.textcolor, __gfx_state.textbgcolor,
+                     __gfx_state.textsize);
+    else
+      gfx_drawChar(__gfx_state.cursor_x, __gfx_state.cursor_y, 
                 c, __gfx_state.textcolor, __gfx_state.textbgcolor,
                  __gfx_state.textsize);
-    __gfx_state.cursor_x += __gfx_state.textsize*8;
-    if (__gfx_state.wrap && (__gfx_state.cursor_x > (__gfx_state._width - __gfx_state.textsize*8))) {
-      __gfx_state.cursor_y += __gfx_state.textsize*12;
+    __gfx_state.cursor_x += __gfx_state.textsize*w;
+    if (__gfx_state.wrap && (__gfx_state.cursor_x > (__gfx_state._width - __gfx_state.textsize*w))) {
+      __gfx_state.cursor_y += __gfx_state.textsize*h;
       __gfx_state.cursor_x = 0;
     }
   }
@@ -403,51 +987,244 @@ void gfx_puts(char *s) {
 }
 
 // Draw a character
+// Opaque glyphs go to the panel in bursts of this many pixels (one
+// whole 7 x 12 glyph at size 1)
+#define GFX_CHAR_BURST  96
+
+// Largest size that is drawn a widened row at a time (the row has to
+// fit in the burst buffer)
+#define GFX_CHAR_MAXSCALE   8
+
+// Draw a character in the current font. The glyph is a cell of
+// width x height pixels (font) each drawn size x size, and may hang off
+// any edge of the clip rectangle; characters the font doesn't have are
+// blank.
+// Opaque text (bg != color) straight to the panel is one window and one
+// burst of pixels, and if the whole glyph is on screen those pixels
+// come from (or go into) the glyph cache. Transparent text, or text
+// into a tile, is drawn as the glyph's precomputed runs with
+// gfx_fillRect().
 void gfx_drawChar(int16_t x, int16_t y, unsigned char c,
 			    uint16_t color, uint16_t bg, uint8_t size) {
 
-  int8_t i, j, line;
-  int8_t descender;
-  unsigned const char *glyph;
+  const struct gfx_font *f = __gfx_state.font;
+  GFX_SCOPE(GFX_SCOPE_CHAR);
+  GFX_RECORD(GFX_DL_CHAR, x, y, c, color, bg, size, f->id);
+  GFX_DAMAGE(x, y, f->width*size, f->height*size);
+  GFX_REJECT(x, y, f->width*size, f->height*size);
+  uint16_t buf[GFX_CHAR_BURST];
+  uint16_t *out = buf;
+  int16_t i, j, k, r, n, w;
+  int32_t x0, y0, x1, y1, px, py, top, bot;
+  const uint8_t *rows;
+  uint16_t g;
+  int hit;
 
-  glyph = &mcm_font[(c & 0x7f) * 9];
-  if((x >= __gfx_state._width)            || // Clip right
-     (y >= __gfx_state._height)           || // Clip bottom
-     ((x + 9 * size) < 0) || // Clip left
-     ((y + 12 * size) < 0))   // Clip top
+  x0 = x;
+  y0 = y;
+  x1 = (int32_t) x + f->width * size - 1;
+  y1 = (int32_t) y + f->height * size - 1;
+  if (x0 < __gfx_state.clip.x0) x0 = __gfx_state.clip.x0;
+  if (y0 < __gfx_state.clip.y0) y0 = __gfx_state.clip.y0;
+  if (x1 > __gfx_state.clip.x1) x1 = __gfx_state.clip.x1;
+  if (y1 > __gfx_state.clip.y1) y1 = __gfx_state.clip.y1;
+  if ((size == 0) || (x0 > x1) || (y0 > y1))
     return;
 
-  descender = (*glyph & 0x80) != 0;
+  if ((c < f->first) || (c > f->last))
+    c = ' ';
+  g = c - f->first;
+  if ((bg != color) && ! __gfx_state.tile && (x0 == x) && (y0 == y) &&
+      (x1 == x + f->width * size - 1) && (y1 == y + f->height * size - 1)) {
+    out = gfx_glyph_lookup(f, c, color, bg, size, &hit);
+    if (out && hit) {
+      lcd_set_scan(LCD_SCAN_H);
+      lcd_set_window(x0, y0, x1, y1);
+      lcd_write_pixels(out, f->width * f->height * size * size);
+      return;
+    }
+    if (! out)
+      out = buf;
+  }
+
+  // The runs (see mkfont.c) are the set cells of the glyph already cut
+  // into rectangles, so blank rows and columns are never looked at.
+  if ((bg == color) || __gfx_state.tile) {
+    if (bg != color)
+      gfx_fillRect(x, y, f->width * size, f->height * size, bg);
+    for (k = f->runs_index[g]; k < f->runs_index[g + 1]; k++) {
+      uint16_t run = f->runs[k];
+      gfx_fillRect(x + ((run >> 8) & 0xf) * size, y + (run >> 12) * size,
+                   ((run >> 4) & 0xf) * size, (run & 0xf) * size, color);
+    }
+    return;
+  }
 
-  for (i=0; i<12; i++ ) {
-    line = 0x00;
-    if ( descender ) {
-        if (i > 2) {
-          line = *(glyph + (i - 3));
+  // Straight to the panel. A glyph is a byte per line of its cell, bit
+  // 7 on the left, the order the panel is written in. Up to
+  // GFX_CHAR_MAXSCALE a line of the glyph is widened by size once and
+  // then sent (or copied into the cache) once for each line of the
+  // screen it covers. Bigger than that (or with charpixels set, so the
+  // bench can compare) each pixel is worked out on its own. Either way
+  // it is one window and one stream of pixels.
+  rows = f->rows + g * f->height;
+  lcd_set_scan(LCD_SCAN_H);
+  lcd_set_window(x0, y0, x1, y1);
+  n = 0;
+  if ((size <= GFX_CHAR_MAXSCALE) && ! __gfx_state.charpixels) {
+    w = x1 - x0 + 1;
+    for (i = (y0 - y) / size; i <= (y1 - y) / size; i++) {
+      k = 0;
+      for (j = 0, px = x; j < f->width; j++, px += size) {
+        uint16_t pc = (rows[i] & (0x80 >> j)) ? color : bg;
+        for (r = 0; r < size; r++) {
+          if ((px + r >= x0) && (px + r <= x1))
+            buf[k++] = pc;
         }
-    } else {
-        if (i < 9) {
-            line = *(glyph + i);
+      }
+      top = y + i * size;
+      bot = top + size - 1;
+      if (top < y0) top = y0;
+      if (bot > y1) bot = y1;
+      for (py = top; py <= bot; py++) {
+        if (out == buf) {
+          lcd_write_pixels(buf, w);
+        } else {
+          memcpy(out + n, buf, w * sizeof(uint16_t));
+          n += w;
         }
+      }
+    }
+    if (out != buf)
+      lcd_write_pixels(out, n);
+    return;
+  }
+  for (py = y0; py <= y1; py++) {
+    uint8_t line = rows[(py - y) / size];
+    for (px = x0; px <= x1; px++) {
+      out[n++] = (line & (0x80 >> ((px - x) / size))) ? color : bg;
+      if ((out == buf) && (n == GFX_CHAR_BURST)) {
+        lcd_write_pixels(buf, n);
+        n = 0;
+      }
+    }
+  }
+  if (n)
+    lcd_write_pixels(out, n);
+}
+
+// Anti-aliased text is 2 bits a pixel, each pixel one of 4 colors from
+// bg to color. Those are worked out once when the colors change, not
+// per pixel, so a glyph is just table lookups.
+static uint16_t aa_lut[4];
+static uint16_t aa_fg, aa_bg;
+static uint8_t aa_valid;
+
+static const uint16_t *gfx_aaTable(uint16_t color, uint16_t bg) {
+  uint16_t i, r, g, b;
+
+  if (aa_valid && (color == aa_fg) && (bg == aa_bg))
+    return aa_lut;
+  for (i = 0; i < 4; i++) {
+    r = ((color >> 11) * i + (bg >> 11) * (3 - i) + 1) / 3;
+    g = (((color >> 5) & 0x3f) * i + ((bg >> 5) & 0x3f) * (3 - i) + 1) / 3;
+    b = ((color & 0x1f) * i + (bg & 0x1f) * (3 - i) + 1) / 3;
+    aa_lut[i] = (r << 11) | (g << 5) | b;
+  }
+  aa_fg = color;
+  aa_bg = bg;
+  aa_valid = 1;
+  return aa_lut;
+}
+
+// Draw a character anti-aliased (the font's aa glyphs) against bg. It
+// is clipped and windowed just like gfx_drawChar() and costs the same
+// on the bus, one burst of pixels. Transparent text (bg == color) has
+// nothing to blend with and is drawn by gfx_drawChar().
+void gfx_drawCharAA(int16_t x, int16_t y, unsigned char c,
+			    uint16_t color, uint16_t bg, uint8_t size) {
+
+  const struct gfx_font *f = __gfx_state.font;
+  GFX_SCOPE(GFX_SCOPE_CHAR);
+  GFX_RECORD(GFX_DL_CHAR_AA, x, y, c, color, bg, size, f->id);
+  GFX_DAMAGE(x, y, f->width*size, f->height*size);
+  GFX_REJECT(x, y, f->width*size, f->height*size);
+  uint16_t buf[GFX_CHAR_BURST];
+  const uint16_t *lut, *aa;
+  int16_t i, j, k, r, n, w;
+  int32_t x0, y0, x1, y1, px, py, top, bot;
+
+  if (bg == color) {
+    gfx_drawChar(x, y, c, color, bg, size);
+    return;
+  }
+  x0 = x;
+  y0 = y;
+  x1 = (int32_t) x + f->width * size - 1;
+  y1 = (int32_t) y + f->height * size - 1;
+  if (x0 < __gfx_state.clip.x0) x0 = __gfx_state.clip.x0;
+  if (y0 < __gfx_state.clip.y0) y0 = __gfx_state.clip.y0;
+  if (x1 > __gfx_state.clip.x1) x1 = __gfx_state.clip.x1;
+  if (y1 > __gfx_state.clip.y1) y1 = __gfx_state.clip.y1;
+  if ((size == 0) || (x0 > x1) || (y0 > y1))
+    return;
+
+  if ((c < f->first) || (c > f->last))
+    c = ' ';
+  aa = f->aa + (c - f->first) * f->height;
+  lut = gfx_aaTable(color, bg);
+
+  // Into a tile, a fill for each run of pixels at the same level
+  if (__gfx_state.tile) {
+    for (i = 0; i < f->height; i++) {
+      for (j = 0; j < f->width; j += n) {
+        uint8_t level = (aa[i] >> (14 - 2 * j)) & 3;
+        for (n = 1; (j + n < f->width) &&
+               (((aa[i] >> (14 - 2 * (j + n))) & 3) == level); n++)
+          ;
+        gfx_fillRect(x + j*size, y + i*size, n*size, size, lut[level]);
+      }
     }
-    line &= 0x7f;
-    for (j = 0; j<8; j++) {
-      if (line & 0x80) {
-        if (size == 1) // default size
-          gfx_drawPixel(x+i, y+j, color);
-        else {  // big size
-          gfx_fillRect(x+(j*size), y+(i*size), size, size, color);
-        } 
-      } else if (bg != color) {
-        if (size == 1) // default size
-          gfx_drawPixel(x+j, y+i, bg);
-        else {  // big size
-          gfx_fillRect(x+j*size, y+i*size, size, size, bg);
+    return;
+  }
+
+  lcd_set_scan(LCD_SCAN_H);
+  lcd_set_window(x0, y0, x1, y1);
+  w = x1 - x0 + 1;
+  if (w <= GFX_CHAR_BURST) {
+    // a line of the glyph is looked up and widened once, and sent once
+    // for each line of the screen it covers
+    for (i = (y0 - y) / size; i <= (y1 - y) / size; i++) {
+      k = 0;
+      for (j = 0, px = x; j < f->width; j++, px += size) {
+        uint16_t pc = lut[(aa[i] >> (14 - 2 * j)) & 3];
+        for (r = 0; r < size; r++) {
+          if ((px + r >= x0) && (px + r <= x1))
+            buf[k++] = pc;
         }
       }
-      line <<= 1;
+      top = y + i * size;
+      bot = top + size - 1;
+      if (top < y0) top = y0;
+      if (bot > y1) bot = y1;
+      for (py = top; py <= bot; py++)
+        lcd_write_pixels(buf, w);
     }
+    return;
   }
+  n = 0;
+  for (py = y0; py <= y1; py++) {
+    uint16_t line = aa[(py - y) / size];
+    for (px = x0; px <= x1; px++) {
+      buf[n++] = lut[(line >> (14 - 2 * ((px - x) / size))) & 3];
+      if (n == GFX_CHAR_BURST) {
+        lcd_write_pixels(buf, n);
+        n = 0;
+      }
+    }
+  }
+  if (n)
+    lcd_write_pixels(buf, n);
 }
 
 void gfx_setCursor(int16_t x, int16_t y) {
@@ -464,16 +1241,31 @@ void gfx_setTextColor(uint16_t c, uint16_t b) {
   __gfx_state.textbgcolor = b; 
 }
 
+void gfx_setFont(const struct gfx_font *f) {
+  __gfx_state.font = f ? f : &gfx_font_7x12;
+}
+
+const struct gfx_font *gfx_getFont(void) {
+  return __gfx_state.font;
+}
+
 void gfx_setTextWrap(uint8_t w) {
   __gfx_state.wrap = w;
 }
 
+void gfx_setTextAA(uint8_t aa) {
+  __gfx_state.textaa = aa;
+}
+
 uint8_t gfx_getRotation(void) {
   return __gfx_state.rotation;
 }
 
+// Rotation is done by the controller (lcd_set_rotation()), everything
+// here just works in the rotated width and height.
 void gfx_setRotation(uint8_t x) {
   __gfx_state.rotation = (x & 3);
+  lcd_set_rotation(__gfx_state.rotation);
   switch(__gfx_state.rotation) {
    case 0:
    case 2:
@@ -486,6 +1278,40 @@ void gfx_setRotation(uint8_t x) {
     __gfx_state._height = GFX_WIDTH;
     break;
   }
+  // the old clip rectangles are in the old orientation
+  __gfx_state.nclips  = 0;
+  __gfx_state.clip.x0 = 0;
+  __gfx_state.clip.y0 = 0;
+  __gfx_state.clip.x1 = __gfx_state._width - 1;
+  __gfx_state.clip.y1 = __gfx_state._height - 1;
+}
+
+// Narrow the clip rectangle to where it overlaps x, y, w, h. While a
+// display list is being recorded the push is recorded too, so the
+// commands after it are clipped the same way when they are replayed.
+int gfx_pushClip(int16_t x, int16_t y, int16_t w, int16_t h) {
+  struct gfx_clip *c = &__gfx_state.clip;
+  int32_t x1 = (int32_t) x + w - 1;
+  int32_t y1 = (int32_t) y + h - 1;
+
+  if (__gfx_state.nclips == GFX_CLIP_DEPTH)
+    return -1;
+  if (__gfx_state.dl)
+    gfx_dl_record(GFX_DL_CLIP, x, y, w, h);
+  __gfx_state.clips[__gfx_state.nclips++] = *c;
+  if (x > c->x0) c->x0 = x;
+  if (y > c->y0) c->y0 = y;
+  if (x1 < c->x1) c->x1 = x1;
+  if (y1 < c->y1) c->y1 = y1;
+  return 0;
+}
+
+void gfx_popClip(void) {
+  if (__gfx_state.nclips == 0)
+    return;
+  if (__gfx_state.dl)
+    gfx_dl_record(GFX_DL_UNCLIP);
+  __gfx_state.clip = __gfx_state.clips[--__gfx_state.nclips];
 }
 
 // Return the size of the display (per current rotation)
@@ -34,12 +34,20 @@ void gfx_fillRoundRect(int16_t x0, int16_t y0, int16_t w, int16_t h,
       int16_t radius, uint16_t color);
 void gfx_drawBitmap(int16_t x, int16_t y, const uint8_t *bitmap,
       int16_t w, int16_t h, uint16_t color);
+void gfx_drawRGBBitmap(int16_t x, int16_t y, const uint16_t *bitmap,
+      int16_t w, int16_t h, int16_t stride);
+void gfx_drawBitmapOpaque(int16_t x, int16_t y, const uint8_t *bitmap,
+      int16_t w, int16_t h, uint16_t color, uint16_t bg, int16_t sx,
+      int16_t stride);
 void gfx_drawChar(int16_t x, int16_t y, unsigned char c, uint16_t color,
       uint16_t bg, uint8_t size);
+void gfx_drawCharAA(int16_t x, int16_t y, unsigned char c, uint16_t color,
+      uint16_t bg, uint8_t size);
 void gfx_setCursor(int16_t x, int16_t y);
 void gfx_setTextColor(uint16_t c, uint16_t bg);
 void gfx_setTextSize(uint8_t s);
 void gfx_setTextWrap(uint8_t w);
+void gfx_setTextAA(uint8_t aa);
 void gfx_setRotation(uint8_t r);
 void gfx_puts(char *);
 void gfx_write(uint8_t);
@@ -52,11 +60,254 @@ uint8_t gfx_getRotation(void);
 #define GFX_WIDTH   320
 #define GFX_HEIGHT  240
 
+/*
+ * A font (gfx_fonts.c, compiled from the source fonts by mkfont.c).
+ * Every font has the same layout: for each glyph a byte per line of
+ * the cell, top to bottom, bit 7 the leftmost pixel, the glyph's
+ * pixels again as runs (see mkfont.c) for transparent text, and an
+ * anti-aliased copy at 2 bits a pixel for gfx_drawCharAA(). Cells are
+ * at most 8 wide and 15 high.
+ */
+struct gfx_font {
+    const char *name;
+    uint8_t id;             // index in gfx_fonts[]
+    uint8_t width, height;  // the cell, spacing included
+    uint8_t baseline;       // lines above the baseline
+    uint8_t first, last;    // glyphs first to last are in the font
+    const uint8_t *rows;    // height bytes per glyph
+    const uint16_t *runs_index;     // glyph's first run, last + 2 - first
+    const uint16_t *runs;
+    const uint16_t *aa;     // height words per glyph, pixel 0 in bits 15-14
+};
+
+#define GFX_FONTS   2
+
+extern const struct gfx_font gfx_font_7x12;    // the default
+extern const struct gfx_font gfx_font_5x7;
+extern const struct gfx_font *const gfx_fonts[GFX_FONTS];
+
+void gfx_setFont(const struct gfx_font *f);
+const struct gfx_font *gfx_getFont(void);
+
+/*
+ * Clipping. Everything is drawn clipped to the clip rectangle, which
+ * is the whole screen until gfx_pushClip() narrows it to where it
+ * overlaps x, y, w, h. gfx_popClip() puts back the one before. Up to
+ * GFX_CLIP_DEPTH can be pushed, gfx_pushClip() returns -1 (and clips
+ * nothing) past that. Changing the rotation empties the stack.
+ */
+#ifndef GFX_CLIP_DEPTH
+#define GFX_CLIP_DEPTH  8
+#endif
+
+struct gfx_clip {
+    int16_t x0, y0, x1, y1; // inclusive, x0 > x1 clips everything
+};
+
+int gfx_pushClip(int16_t x, int16_t y, int16_t w, int16_t h);
+void gfx_popClip(void);
+
+/*
+ * A triangle mesh for gfx_fillMesh(). The count vertices are taken
+ * from v in order, or v[index[0]], v[index[1]] ... if index isn't NULL,
+ * and made into triangles three at a time (GFX_MESH_TRIANGLES), each
+ * with the two before it (GFX_MESH_STRIP) or each with the one before
+ * it and the first (GFX_MESH_FAN). Unlike gfx_fillTriangle() a mesh
+ * covers only the pixels whose centers are inside a triangle (or on its
+ * top or left edge), so triangles that share an edge never both draw
+ * it and the mesh costs one write per pixel. The arrays are read at
+ * draw time, so they have to outlive a display list that records it.
+ */
+enum gfx_mesh_mode {
+    GFX_MESH_TRIANGLES,
+    GFX_MESH_STRIP,
+    GFX_MESH_FAN
+};
+
+struct gfx_vertex {
+    int16_t x, y;
+};
+
+struct gfx_mesh {
+    const struct gfx_vertex *v;
+    const uint16_t *index;  // NULL takes the vertices in order
+    uint16_t count;         // vertices (or indices) used
+    uint8_t mode;           // GFX_MESH_*
+};
+
+void gfx_fillMesh(const struct gfx_mesh *m, uint16_t color);
+
+/*
+ * A tile is a small piece of the screen rendered in RAM (gfx_tile.c).
+ * While one is active gfx_drawPixel(), gfx_fillRect() and the bitmap
+ * blits draw into it instead of onto the panel.
+ */
+struct gfx_tile {
+    int16_t x, y;           // top left corner on the screen
+    int16_t w, h;           // buf holds w * h pixels, a line at a time
+    uint16_t *buf;
+};
+
+struct gfx_tile_stats {
+    uint32_t tiles;         // tiles flushed to the panel
+    uint32_t pixels;        // pixels in those tiles
+    uint32_t passes;        // calls made to the draw function
+};
+
+typedef void (*gfx_draw_fn)(void *);
+
+void gfx_tile_fill(struct gfx_tile *t, int16_t x0, int16_t y0, int16_t x1,
+      int16_t y1, uint16_t color);
+void gfx_tile_write(struct gfx_tile *t, int16_t x0, int16_t y0, int16_t x1,
+      int16_t y1, const uint16_t *src, int16_t stride);
+int gfx_tile_setsize(int16_t w, int16_t h);
+void gfx_tile_render(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bg,
+      gfx_draw_fn draw, void *arg);
+void gfx_tile_stats(struct gfx_tile_stats *s, int reset);
+
+struct gfx_damage_stats {
+    uint32_t rects;         // rectangles flushed
+    uint32_t requested;     // pixels asked for (inside the clip)
+    uint32_t flushed;       // pixels actually redrawn
+    uint32_t merges;        // rectangles folded into another one
+};
+
+void gfx_damage_record(uint8_t on);
+void gfx_damage_add(int16_t x, int16_t y, int16_t w, int16_t h);
+void gfx_damage_box(int32_t x0, int32_t y0, int32_t x1, int32_t y1);
+void gfx_damage_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1);
+int gfx_damage_pending(void);
+void gfx_damage_flush(uint16_t bg, gfx_draw_fn draw, void *arg);
+void gfx_damage_stats(struct gfx_damage_stats *s, int reset);
+
+struct gfx_glyph_stats {
+    uint32_t hits;          // glyphs drawn straight from the cache
+    uint32_t misses;        // glyphs that had to be unpacked first
+    uint32_t evictions;     // glyphs thrown out to make room
+    uint32_t bypassed;      // glyphs too big to cache
+    uint16_t entries;       // glyphs in the cache now
+    uint16_t units_used;    // 96 pixel units they take
+    uint16_t units;         // units in the arena
+};
+
+uint16_t *gfx_glyph_lookup(const struct gfx_font *font, uint8_t c,
+      uint16_t fg, uint16_t bg, uint8_t size, int *hit);
+void gfx_glyph_flush(void);
+void gfx_glyph_stats(struct gfx_glyph_stats *s, int reset);
+
+/*
+ * A text field (gfx_text.c) remembers the string it last showed, so an
+ * update only redraws the characters that changed.
+ */
+#ifndef GFX_TEXT_MAX
+#define GFX_TEXT_MAX    24
+#endif
+
+struct gfx_text {
+    const struct gfx_font *font;
+    int16_t x, y;           // top left of the first character
+    uint16_t fg, bg;        // fg == bg is transparent
+    uint8_t size;
+    uint8_t len;            // characters in text
+    uint8_t valid;          // text is what the screen shows
+    char text[GFX_TEXT_MAX + 1];
+};
+
+void gfx_text_init(struct gfx_text *f, int16_t x, int16_t y, uint8_t size,
+      uint16_t fg, uint16_t bg);
+void gfx_text_invalidate(struct gfx_text *f);
+int gfx_text_update(struct gfx_text *f, const char *s);
+void gfx_text_draw(struct gfx_text *f);
+
+/* Display list operations (gfx_dl.c), one per recorded primitive */
+enum gfx_dl_op {
+    GFX_DL_PIXEL,
+    GFX_DL_LINE,
+    GFX_DL_RECT,
+    GFX_DL_FILL_RECT,
+    GFX_DL_CIRCLE,
+    GFX_DL_CIRCLE_HELPER,
+    GFX_DL_FILL_CIRCLE,
+    GFX_DL_FILL_CIRCLE_HELPER,
+    GFX_DL_ROUND_RECT,
+    GFX_DL_FILL_ROUND_RECT,
+    GFX_DL_TRIANGLE,
+    GFX_DL_FILL_TRIANGLE,
+    GFX_DL_BITMAP,
+    GFX_DL_RGB_BITMAP,
+    GFX_DL_BITMAP_OPAQUE,
+    GFX_DL_CHAR,
+    GFX_DL_CHAR_AA,
+    GFX_DL_MESH,
+    GFX_DL_CLIP,
+    GFX_DL_UNCLIP,
+    GFX_DL_NOPS
+};
+
+#define GFX_DL_TILES_MAX    32
+
+struct gfx_dl_stats {
+    uint32_t frames;        // gfx_dl_end() calls
+    uint32_t overflows;     // frames the list was too small for
+    uint16_t cmds;          // commands in the last list rendered
+    uint16_t bytes;         // bytes of encoding they took
+    uint16_t peak_bytes;    // largest list so far
+    uint8_t tiles_x, tiles_y;
+    uint16_t tile_cmds[GFX_DL_TILES_MAX];   // commands replayed per tile
+};
+
+void gfx_dl_begin(uint16_t bg);
+void gfx_dl_record(uint8_t op, ...);
+void gfx_dl_end(void);
+void gfx_dl_stats(struct gfx_dl_stats *s, int reset);
+
+/*
+ * Bus cycle accounting (lcd.c, -DLCD_STATS). Each primitive counts
+ * the cycles it causes against its own scope; gfx_stats_dump() prints
+ * them. The outermost primitive gets the cycles, so a round rect's
+ * lines are counted as the round rect.
+ */
+enum gfx_scope {
+    GFX_SCOPE_OTHER = 0,
+    GFX_SCOPE_PIXEL,
+    GFX_SCOPE_LINE,
+    GFX_SCOPE_HLINE,
+    GFX_SCOPE_VLINE,
+    GFX_SCOPE_RECT,
+    GFX_SCOPE_FILL_RECT,
+    GFX_SCOPE_FILL_SCREEN,
+    GFX_SCOPE_CIRCLE,
+    GFX_SCOPE_FILL_CIRCLE,
+    GFX_SCOPE_ROUND_RECT,
+    GFX_SCOPE_FILL_ROUND_RECT,
+    GFX_SCOPE_TRIANGLE,
+    GFX_SCOPE_FILL_TRIANGLE,
+    GFX_SCOPE_BITMAP,
+    GFX_SCOPE_CHAR,
+    GFX_SCOPE_MESH,
+    GFX_SCOPES
+};
+
+#ifdef LCD_STATS
+void gfx_stats_dump(void);
+#else
+#define gfx_stats_dump()
+#endif
+
 struct gfx_state {
     int16_t _width, _height, cursor_x, cursor_y;
     uint16_t textcolor, textbgcolor;
     uint8_t textsize, rotation;
+    const struct gfx_font *font;
     uint8_t wrap;
+    uint8_t textaa;         // gfx_write() draws anti-aliased text
+    uint8_t charpixels;     // scaled text a pixel at a time (lcd_bench)
+    struct gfx_tile *tile;  // non NULL while rendering into a tile
+    uint8_t damage;         // recording damage instead of drawing
+    uint8_t dl;             // recording a display list instead of drawing
+    struct gfx_clip clip;   // what everything is clipped to
+    struct gfx_clip clips[GFX_CLIP_DEPTH];  // the ones pushed over
+    uint8_t nclips;
 };
 
 extern struct gfx_state __gfx_state;
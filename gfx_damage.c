@@ -0,0 +1,213 @@
+/*
+ * Copyright (C) 2013 Chuck McManis (cmcmanis@mcmanis.com)
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ */
+
+/*
+ * gfx_damage.c - only redraw what changed
+ *
+ * Rather than repaint a whole panel because a couple of digits in it
+ * changed, the code that knows what changed marks those areas as
+ * "damaged" and then, at a point of its choosing, asks for a flush.
+ * The flush runs the full scene draw function through the tile
+ * renderer (gfx_tile.c) for just the damaged rectangles, so nothing
+ * else on the bus moves.
+ *
+ * Areas can be added directly with gfx_damage_add(), or by turning on
+ * recording with gfx_damage_record(1) and making the usual gfx_* calls,
+ * each primitive then adds its bounding box and draws nothing.
+ *
+ * The list is at most GFX_DAMAGE_MAX rectangles. A new rectangle that
+ * overlaps or touches one already there is merged with it (and the
+ * result is checked against the rest again). When the list is full the
+ * new one is merged into whichever rectangle grows the least by taking
+ * it on. The stats show how well that works out: pixels requested
+ * versus pixels actually redrawn.
+ */
+
+#include <stdint.h>
+#include "gfx.h"
+
+#ifndef GFX_DAMAGE_MAX
+#define GFX_DAMAGE_MAX  8
+#endif
+
+struct damage_rect {
+    int16_t x0, y0, x1, y1;     /* inclusive */
+};
+
+static struct damage_rect damage[GFX_DAMAGE_MAX];
+static int damage_count;
+static struct gfx_damage_stats damage_stats;
+
+static uint32_t
+rect_area(const struct damage_rect *r) {
+    return (uint32_t) (r->x1 - r->x0 + 1) * (r->y1 - r->y0 + 1);
+}
+
+/* Does a overlap b, or sit right next to it? */
+static int
+rect_touches(const struct damage_rect *a, const struct damage_rect *b) {
+    return (a->x0 <= b->x1 + 1) && (b->x0 <= a->x1 + 1) &&
+           (a->y0 <= b->y1 + 1) && (b->y0 <= a->y1 + 1);
+}
+
+static void
+rect_union(struct damage_rect *a, const struct damage_rect *b) {
+    if (b->x0 < a->x0) a->x0 = b->x0;
+    if (b->y0 < a->y0) a->y0 = b->y0;
+    if (b->x1 > a->x1) a->x1 = b->x1;
+    if (b->y1 > a->y1) a->y1 = b->y1;
+}
+
+/* take entry i out of the list */
+static void
+damage_remove(int i) {
+    damage[i] = damage[--damage_count];
+}
+
+/*
+ * gfx_damage_record(on)
+ *
+ * While on, gfx_* drawing calls only add their bounding box.
+ */
+void
+gfx_damage_record(uint8_t on) {
+    __gfx_state.damage = on;
+}
+
+/*
+ * gfx_damage_box(x0, y0, x1, y1)
+ *
+ * Mark the box x0..x1, y0..y1 (inclusive, what of it is inside the
+ * clip rectangle) as needing a redraw. It takes 32 bit corners so a
+ * primitive that reaches far off the screen (a long line, a huge
+ * circle) is cut to the clip before anything is narrowed to 16 bits.
+ */
+void
+gfx_damage_box(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+    struct damage_rect r;
+    uint32_t grow, best_grow;
+    int i, best;
+
+    if (x0 < __gfx_state.clip.x0) x0 = __gfx_state.clip.x0;
+    if (y0 < __gfx_state.clip.y0) y0 = __gfx_state.clip.y0;
+    if (x1 > __gfx_state.clip.x1) x1 = __gfx_state.clip.x1;
+    if (y1 > __gfx_state.clip.y1) y1 = __gfx_state.clip.y1;
+    if ((x0 > x1) || (y0 > y1)) {
+        return;
+    }
+    r.x0 = (int16_t) x0;
+    r.y0 = (int16_t) y0;
+    r.x1 = (int16_t) x1;
+    r.y1 = (int16_t) y1;
+    damage_stats.requested += rect_area(&r);
+
+    for (;;) {
+        /* soak up everything it overlaps or touches */
+        for (i = 0; i < damage_count; ) {
+            if (rect_touches(&r, &damage[i])) {
+                rect_union(&r, &damage[i]);
+                damage_remove(i);
+                damage_stats.merges++;
+                i = 0;
+            } else {
+                i++;
+            }
+        }
+        if (damage_count < GFX_DAMAGE_MAX) {
+            damage[damage_count++] = r;
+            return;
+        }
+
+        /*
+         * Full, so fold it into the one that grows the least. The
+         * result may now touch others, hence going round again.
+         */
+        best = 0;
+        best_grow = 0xffffffff;
+        for (i = 0; i < damage_count; i++) {
+            struct damage_rect u = damage[i];
+
+            rect_union(&u, &r);
+            grow = rect_area(&u) - rect_area(&damage[i]);
+            if (grow < best_grow) {
+                best_grow = grow;
+                best = i;
+            }
+        }
+        rect_union(&r, &damage[best]);
+        damage_remove(best);
+        damage_stats.merges++;
+    }
+}
+
+/*
+ * gfx_damage_add(x, y, w, h)
+ *
+ * Mark the rectangle x, y, w, h as needing a redraw.
+ */
+void
+gfx_damage_add(int16_t x, int16_t y, int16_t w, int16_t h) {
+    gfx_damage_box(x, y, (int32_t) x + w - 1, (int32_t) y + h - 1);
+}
+
+/*
+ * gfx_damage_line(x0, y0, x1, y1)
+ *
+ * The bounding box of two points, in any order.
+ */
+void
+gfx_damage_line(int16_t x0, int16_t y0, int16_t x1, int16_t y1) {
+    gfx_damage_box((x0 < x1) ? x0 : x1, (y0 < y1) ? y0 : y1,
+                   (x0 < x1) ? x1 : x0, (y0 < y1) ? y1 : y0);
+}
+
+/* How many rectangles are waiting */
+int
+gfx_damage_pending(void) {
+    return damage_count;
+}
+
+/*
+ * gfx_damage_flush(bg, draw, arg)
+ *
+ * Redraw every damaged rectangle by running draw(arg) through the tile
+ * renderer over it (on a bg background), then forget them.
+ */
+void
+gfx_damage_flush(uint16_t bg, gfx_draw_fn draw, void *arg) {
+    uint8_t recording = __gfx_state.damage;
+    int i;
+
+    __gfx_state.damage = 0;
+    for (i = 0; i < damage_count; i++) {
+        gfx_tile_render(damage[i].x0, damage[i].y0,
+                        damage[i].x1 - damage[i].x0 + 1,
+                        damage[i].y1 - damage[i].y0 + 1, bg, draw, arg);
+        damage_stats.rects++;
+        damage_stats.flushed += rect_area(&damage[i]);
+    }
+    damage_count = 0;
+    __gfx_state.damage = recording;
+}
+
+/*
+ * gfx_damage_stats(s, reset)
+ *
+ * Copy out the counters, and zero them if reset is set.
+ */
+void
+gfx_damage_stats(struct gfx_damage_stats *s, int reset) {
+    if (s) {
+        *s = damage_stats;
+    }
+    if (reset) {
+        damage_stats.rects = damage_stats.requested = 0;
+        damage_stats.flushed = damage_stats.merges = 0;
+    }
+}
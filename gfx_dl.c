@@ -0,0 +1,483 @@
+/*
+ * Copyright (C) 2013 Chuck McManis (cmcmanis@mcmanis.com)
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ */
+
+/*
+ * gfx_dl.c - record a frame, then draw it a tile at a time
+ *
+ * Between gfx_dl_begin() and gfx_dl_end() the gfx_* primitives don't
+ * draw, each one is appended to a display list instead (see GFX_RECORD
+ * in gfx.c). As a command goes in, its bounding box is worked out and
+ * it is "binned": a bit is set for every screen tile it touches. At
+ * gfx_dl_end() each tile that anything touched is rendered once
+ * through the tile renderer (gfx_tile.c), replaying only the commands
+ * that have its bit set, and then the list is thrown away.
+ *
+ * So every pixel of a frame crosses the bus exactly once no matter how
+ * many layers were drawn over it, and the frame comes out the same way
+ * every time regardless of what was on the panel before. Tiles nothing
+ * touched are left as they are.
+ *
+ * The encoding is an op byte followed by its arguments as 16 bit
+ * values (a bitmap or mesh adds its pointer), so most commands are 9
+ * to 15 bytes and a typical screen of a few dozen widgets and some text
+ * fits in the default 2K. If the list fills up mid frame what has been
+ * recorded so far is rendered and the rest of the frame is drawn
+ * directly, as if there were no list. The picture is still right (it
+ * is painted in the same order) it just costs the overdraw the list
+ * was supposed to save, and the overflows counter says it happened.
+ *
+ * gfx_pushClip() and gfx_popClip() are recorded too, and replayed in
+ * every tile, so what is drawn after a push is clipped the same way
+ * when it is rendered. The clip rectangle at gfx_dl_begin() is the one
+ * the frame is rendered in; clips pushed while recording should be
+ * popped before gfx_dl_end(), and ones pushed before gfx_dl_begin()
+ * left alone until after it.
+ */
+
+#include <stdint.h>
+#include <stdarg.h>
+#include <string.h>
+#include "gfx.h"
+
+#ifndef GFX_DL_BYTES
+#define GFX_DL_BYTES    2048
+#endif
+#ifndef GFX_DL_CMDS
+#define GFX_DL_CMDS     192
+#endif
+
+/* the binning grid, should match the tile renderer's tile */
+#ifndef GFX_DL_TILE_W
+#define GFX_DL_TILE_W   64
+#endif
+#ifndef GFX_DL_TILE_H
+#define GFX_DL_TILE_H   48
+#endif
+
+#define DL_COLS(w)  (((w) + GFX_DL_TILE_W - 1) / GFX_DL_TILE_W)
+#define DL_ROWS(h)  (((h) + GFX_DL_TILE_H - 1) / GFX_DL_TILE_H)
+
+#if (DL_COLS(GFX_WIDTH) * DL_ROWS(GFX_HEIGHT) > GFX_DL_TILES_MAX) || \
+    (DL_COLS(GFX_HEIGHT) * DL_ROWS(GFX_WIDTH) > GFX_DL_TILES_MAX)
+#error "display list tile grid is too fine, make GFX_DL_TILE_W/H bigger"
+#endif
+
+/* bitmaps and meshes carry a pointer after their arguments */
+#define DL_HAS_PTR(op)  (((op) == GFX_DL_BITMAP) || \
+                         ((op) == GFX_DL_RGB_BITMAP) || \
+                         ((op) == GFX_DL_BITMAP_OPAQUE) || \
+                         ((op) == GFX_DL_MESH))
+
+/* number of 16 bit arguments for each op */
+static const uint8_t dl_nargs[GFX_DL_NOPS] = {
+    3,      /* PIXEL x y color */
+    5,      /* LINE x0 y0 x1 y1 color */
+    5,      /* RECT x y w h color */
+    5,      /* FILL_RECT x y w h color */
+    4,      /* CIRCLE x0 y0 r color */
+    5,      /* CIRCLE_HELPER x0 y0 r corner color */
+    4,      /* FILL_CIRCLE x0 y0 r color */
+    6,      /* FILL_CIRCLE_HELPER x0 y0 r corner delta color */
+    6,      /* ROUND_RECT x y w h r color */
+    6,      /* FILL_ROUND_RECT x y w h r color */
+    7,      /* TRIANGLE x0 y0 x1 y1 x2 y2 color */
+    7,      /* FILL_TRIANGLE x0 y0 x1 y1 x2 y2 color */
+    5,      /* BITMAP x y w h color (+ pointer) */
+    5,      /* RGB_BITMAP x y w h stride (+ pointer) */
+    8,      /* BITMAP_OPAQUE x y w h color bg sx stride (+ pointer) */
+    7,      /* CHAR x y c fg bg size font */
+    7,      /* CHAR_AA x y c fg bg size font */
+    5,      /* MESH x y w h color (+ pointer), x y w h is its bbox */
+    4,      /* CLIP x y w h */
+    0,      /* UNCLIP */
+};
+
+static uint8_t dl_buf[GFX_DL_BYTES];
+static uint16_t dl_bytes;
+static uint16_t dl_offset[GFX_DL_CMDS];
+static uint32_t dl_bins[GFX_DL_CMDS];
+static uint16_t dl_ncmds;
+static uint16_t dl_bg;
+static struct gfx_clip dl_clip;     /* the clip at gfx_dl_begin() */
+static uint8_t dl_nclips;
+static struct gfx_dl_stats dl_stats;
+
+static int16_t
+min2(int16_t a, int16_t b) {
+    return (b < a) ? b : a;
+}
+
+static int16_t
+max2(int16_t a, int16_t b) {
+    return (b > a) ? b : a;
+}
+
+static int16_t
+min3(int16_t a, int16_t b, int16_t c) {
+    if (b < a) a = b;
+    return (c < a) ? c : a;
+}
+
+static int16_t
+max3(int16_t a, int16_t b, int16_t c) {
+    if (b > a) a = b;
+    return (c > a) ? c : a;
+}
+
+/*
+ * Screen area (inclusive) a command can touch. It is worked out in 32
+ * bits, a big circle or a long line reaches further than an int16_t.
+ */
+static void
+dl_bbox(uint8_t op, const int16_t *a, int32_t *x0, int32_t *y0,
+        int32_t *x1, int32_t *y1) {
+    switch (op) {
+        case GFX_DL_PIXEL:
+            *x0 = *x1 = a[0];
+            *y0 = *y1 = a[1];
+            break;
+        case GFX_DL_LINE:
+            *x0 = min2(a[0], a[2]);
+            *x1 = max2(a[0], a[2]);
+            *y0 = min2(a[1], a[3]);
+            *y1 = max2(a[1], a[3]);
+            break;
+        case GFX_DL_CIRCLE:
+        case GFX_DL_CIRCLE_HELPER:
+        case GFX_DL_FILL_CIRCLE:
+            *x0 = a[0] - a[2];
+            *y0 = a[1] - a[2];
+            *x1 = a[0] + a[2];
+            *y1 = a[1] + a[2];
+            break;
+        case GFX_DL_FILL_CIRCLE_HELPER:
+            *x0 = a[0] - a[2];
+            *y0 = a[1] - a[2];
+            *x1 = a[0] + a[2];
+            *y1 = a[1] + a[2] + a[4];
+            break;
+        case GFX_DL_TRIANGLE:
+        case GFX_DL_FILL_TRIANGLE:
+            *x0 = min3(a[0], a[2], a[4]);
+            *x1 = max3(a[0], a[2], a[4]);
+            *y0 = min3(a[1], a[3], a[5]);
+            *y1 = max3(a[1], a[3], a[5]);
+            break;
+        case GFX_DL_CHAR:
+        case GFX_DL_CHAR_AA:
+            *x0 = a[0];
+            *y0 = a[1];
+            *x1 = a[0] + gfx_fonts[a[6]]->width * a[5] - 1;
+            *y1 = a[1] + gfx_fonts[a[6]]->height * a[5] - 1;
+            break;
+        default:    /* everything else is x y w h ... */
+            *x0 = a[0];
+            *y0 = a[1];
+            *x1 = a[0] + a[2] - 1;
+            *y1 = a[1] + a[3] - 1;
+            break;
+    }
+}
+
+/* Which tiles does the area x0..x1, y0..y1 touch, clipped? */
+static uint32_t
+dl_bin(int32_t x0, int32_t y0, int32_t x1, int32_t y1) {
+    int cols = DL_COLS(gfx_width());
+    int rows = DL_ROWS(gfx_height());
+    int c0, c1, r0, r1, r, c;
+    uint32_t bins = 0;
+
+    if (x0 < __gfx_state.clip.x0) x0 = __gfx_state.clip.x0;
+    if (y0 < __gfx_state.clip.y0) y0 = __gfx_state.clip.y0;
+    if (x1 > __gfx_state.clip.x1) x1 = __gfx_state.clip.x1;
+    if (y1 > __gfx_state.clip.y1) y1 = __gfx_state.clip.y1;
+    if ((x0 > x1) || (y0 > y1)) {
+        return 0;
+    }
+    c0 = x0 / GFX_DL_TILE_W;
+    c1 = x1 / GFX_DL_TILE_W;
+    r0 = y0 / GFX_DL_TILE_H;
+    r1 = y1 / GFX_DL_TILE_H;
+    for (r = r0; (r <= r1) && (r < rows); r++) {
+        for (c = c0; (c <= c1) && (c < cols); c++) {
+            bins |= (uint32_t) 1 << (r * cols + c);
+        }
+    }
+    return bins;
+}
+
+/* Pull the arguments of command n back out of the list */
+static uint8_t
+dl_decode(uint16_t n, int16_t *a, const uint8_t **ptr) {
+    const uint8_t *p = &dl_buf[dl_offset[n]];
+    uint8_t op = *p++;
+
+    memcpy(a, p, dl_nargs[op] * sizeof(int16_t));
+    p += dl_nargs[op] * sizeof(int16_t);
+    if (DL_HAS_PTR(op)) {
+        memcpy(ptr, p, sizeof(*ptr));
+    }
+    return op;
+}
+
+/* Draw one recorded command for real */
+static void
+dl_play(uint8_t op, const int16_t *a, const uint8_t *ptr) {
+    const struct gfx_font *font;
+
+    switch (op) {
+        case GFX_DL_PIXEL:
+            gfx_drawPixel(a[0], a[1], a[2]);
+            break;
+        case GFX_DL_LINE:
+            gfx_drawLine(a[0], a[1], a[2], a[3], a[4]);
+            break;
+        case GFX_DL_RECT:
+            gfx_drawRect(a[0], a[1], a[2], a[3], a[4]);
+            break;
+        case GFX_DL_FILL_RECT:
+            gfx_fillRect(a[0], a[1], a[2], a[3], a[4]);
+            break;
+        case GFX_DL_CIRCLE:
+            gfx_drawCircle(a[0], a[1], a[2], a[3]);
+            break;
+        case GFX_DL_CIRCLE_HELPER:
+            gfx_drawCircleHelper(a[0], a[1], a[2], a[3], a[4]);
+            break;
+        case GFX_DL_FILL_CIRCLE:
+            gfx_fillCircle(a[0], a[1], a[2], a[3]);
+            break;
+        case GFX_DL_FILL_CIRCLE_HELPER:
+            gfx_fillCircleHelper(a[0], a[1], a[2], a[3], a[4], a[5]);
+            break;
+        case GFX_DL_ROUND_RECT:
+            gfx_drawRoundRect(a[0], a[1], a[2], a[3], a[4], a[5]);
+            break;
+        case GFX_DL_FILL_ROUND_RECT:
+            gfx_fillRoundRect(a[0], a[1], a[2], a[3], a[4], a[5]);
+            break;
+        case GFX_DL_TRIANGLE:
+            gfx_drawTriangle(a[0], a[1], a[2], a[3], a[4], a[5], a[6]);
+            break;
+        case GFX_DL_FILL_TRIANGLE:
+            gfx_fillTriangle(a[0], a[1], a[2], a[3], a[4], a[5], a[6]);
+            break;
+        case GFX_DL_BITMAP:
+            gfx_drawBitmap(a[0], a[1], ptr, a[2], a[3], a[4]);
+            break;
+        case GFX_DL_RGB_BITMAP:
+            gfx_drawRGBBitmap(a[0], a[1], (const uint16_t *) ptr, a[2], a[3],
+                              a[4]);
+            break;
+        case GFX_DL_BITMAP_OPAQUE:
+            gfx_drawBitmapOpaque(a[0], a[1], ptr, a[2], a[3], a[4], a[5],
+                                 a[6], a[7]);
+            break;
+        case GFX_DL_CHAR:
+            font = gfx_getFont();
+            gfx_setFont(gfx_fonts[a[6]]);
+            gfx_drawChar(a[0], a[1], a[2], a[3], a[4], a[5]);
+            gfx_setFont(font);
+            break;
+        case GFX_DL_CHAR_AA:
+            font = gfx_getFont();
+            gfx_setFont(gfx_fonts[a[6]]);
+            gfx_drawCharAA(a[0], a[1], a[2], a[3], a[4], a[5]);
+            gfx_setFont(font);
+            break;
+        case GFX_DL_MESH:
+            gfx_fillMesh((const struct gfx_mesh *) ptr, a[4]);
+            break;
+        case GFX_DL_CLIP:
+            gfx_pushClip(a[0], a[1], a[2], a[3]);
+            break;
+        case GFX_DL_UNCLIP:
+            gfx_popClip();
+            break;
+        default:
+            break;
+    }
+}
+
+/* Tile renderer callback, replay the commands binned to tile *arg */
+static void
+dl_replay(void *arg) {
+    uint32_t bit = (uint32_t) 1 << *(int *) arg;
+    const uint8_t *ptr = 0;
+    int16_t a[8];
+    uint8_t nclips = __gfx_state.nclips;
+    uint16_t n;
+    uint8_t op;
+
+    for (n = 0; n < dl_ncmds; n++) {
+        if (dl_bins[n] & bit) {
+            op = dl_decode(n, a, &ptr);
+            dl_play(op, a, ptr);
+        }
+    }
+    /* a list cut short by an overflow can end inside a push */
+    while (__gfx_state.nclips > nclips) {
+        gfx_popClip();
+    }
+}
+
+/* Render and empty the list */
+static void
+dl_render(void) {
+    int cols = DL_COLS(gfx_width());
+    int rows = DL_ROWS(gfx_height());
+    struct gfx_clip clip = __gfx_state.clip;
+    struct gfx_clip clips[GFX_CLIP_DEPTH];
+    uint8_t nclips = __gfx_state.nclips;
+    uint16_t n;
+    int t;
+
+    __gfx_state.dl = 0;
+    /* replay from the clip the frame started with */
+    memcpy(clips, __gfx_state.clips, sizeof(clips));
+    __gfx_state.clip = dl_clip;
+    __gfx_state.nclips = dl_nclips;
+    dl_stats.cmds = dl_ncmds;
+    dl_stats.bytes = dl_bytes;
+    dl_stats.tiles_x = cols;
+    dl_stats.tiles_y = rows;
+    for (t = 0; t < rows * cols; t++) {
+        dl_stats.tile_cmds[t] = 0;
+        for (n = 0; n < dl_ncmds; n++) {
+            /* clips are in every tile, but don't make one worth drawing */
+            if ((dl_bins[n] & ((uint32_t) 1 << t)) &&
+                (dl_buf[dl_offset[n]] < GFX_DL_CLIP)) {
+                dl_stats.tile_cmds[t]++;
+            }
+        }
+        if (dl_stats.tile_cmds[t]) {
+            gfx_tile_render((t % cols) * GFX_DL_TILE_W,
+                            (t / cols) * GFX_DL_TILE_H,
+                            GFX_DL_TILE_W, GFX_DL_TILE_H, dl_bg,
+                            dl_replay, &t);
+        }
+    }
+    dl_ncmds = 0;
+    dl_bytes = 0;
+    memcpy(__gfx_state.clips, clips, sizeof(clips));
+    __gfx_state.clip = clip;
+    __gfx_state.nclips = nclips;
+}
+
+/*
+ * gfx_dl_begin(bg)
+ *
+ * Start recording a frame. Tiles start out bg when they are rendered.
+ */
+void
+gfx_dl_begin(uint16_t bg) {
+    dl_ncmds = 0;
+    dl_bytes = 0;
+    dl_bg = bg;
+    dl_clip = __gfx_state.clip;
+    dl_nclips = __gfx_state.nclips;
+    __gfx_state.dl = 1;
+}
+
+/*
+ * gfx_dl_record(op, args ...)
+ *
+ * Append a command, called by the primitives in gfx.c while recording.
+ * The arguments are the primitive's own, as ints, a bitmap's (or a
+ * mesh's) pointer comes after them.
+ */
+void
+gfx_dl_record(uint8_t op, ...) {
+    int16_t a[8];
+    const uint8_t *ptr = 0;
+    int32_t x0, y0, x1, y1;
+    uint16_t size;
+    uint32_t bins;
+    va_list ap;
+    int i;
+
+    if (op >= GFX_DL_NOPS) {
+        return;
+    }
+    va_start(ap, op);
+    for (i = 0; i < dl_nargs[op]; i++) {
+        a[i] = (int16_t) va_arg(ap, int);
+    }
+    if (DL_HAS_PTR(op)) {
+        ptr = va_arg(ap, const uint8_t *);
+    }
+    va_end(ap);
+
+    if (op >= GFX_DL_CLIP) {
+        bins = ~(uint32_t) 0;
+    } else {
+        dl_bbox(op, a, &x0, &y0, &x1, &y1);
+        bins = dl_bin(x0, y0, x1, y1);
+        if (bins == 0) {
+            return;     /* entirely clipped */
+        }
+    }
+
+    size = 1 + dl_nargs[op] * sizeof(int16_t);
+    if (DL_HAS_PTR(op)) {
+        size += sizeof(ptr);
+    }
+    if ((dl_ncmds == GFX_DL_CMDS) || (dl_bytes + size > GFX_DL_BYTES)) {
+        /* out of room, draw what we have and stop recording */
+        dl_stats.overflows++;
+        __gfx_state.dl = 0;
+        dl_render();
+        if (op < GFX_DL_CLIP) {
+            /* (a clip is applied by gfx_pushClip() itself) */
+            dl_play(op, a, ptr);
+        }
+        return;
+    }
+
+    dl_offset[dl_ncmds] = dl_bytes;
+    dl_bins[dl_ncmds] = bins;
+    dl_buf[dl_bytes] = op;
+    memcpy(&dl_buf[dl_bytes + 1], a, dl_nargs[op] * sizeof(int16_t));
+    if (DL_HAS_PTR(op)) {
+        memcpy(&dl_buf[dl_bytes + size - sizeof(ptr)], &ptr, sizeof(ptr));
+    }
+    dl_bytes += size;
+    dl_ncmds++;
+    if (dl_bytes > dl_stats.peak_bytes) {
+        dl_stats.peak_bytes = dl_bytes;
+    }
+}
+
+/*
+ * gfx_dl_end()
+ *
+ * Stop recording and draw the frame.
+ */
+void
+gfx_dl_end(void) {
+    __gfx_state.dl = 0;
+    dl_render();
+    dl_stats.frames++;
+}
+
+/*
+ * gfx_dl_stats(s, reset)
+ *
+ * Copy out the counters (the per tile counts are for the last list
+ * rendered), and zero them if reset is set.
+ */
+void
+gfx_dl_stats(struct gfx_dl_stats *s, int reset) {
+    if (s) {
+        *s = dl_stats;
+    }
+    if (reset) {
+        memset(&dl_stats, 0, sizeof(dl_stats));
+    }
+}
@@ -0,0 +1,1232 @@
+/*
+ * gfx_fonts.c - generated by mkfont (mkfont.c) from the source fonts,
+ * don't edit. Rebuild it with make -f Makefile.host fonts.
+ */
+
+#include <stdint.h>
+#include "gfx.h"
+
+/* 7x12, 8 x 12 cells */
+static const uint8_t font_7x12_rows[1536] = {
+    0x00, 0x00, 0x00, 0x00, 0x31, 0x4a, 0x44, 0x4a, 0x31, 0x00, 0x00, 0x00,   // 0
+    0x00, 0x00, 0x00, 0x3c, 0x22, 0x3b, 0x22, 0x22, 0x3b, 0x20, 0x20, 0x40,   // 1
+    0x00, 0x00, 0x00, 0x00, 0x61, 0x12, 0x14, 0x18, 0x10, 0x30, 0x30, 0x30,   // 2
+    0x30, 0x48, 0x40, 0x40, 0x20, 0x30, 0x48, 0x48, 0x30, 0x00, 0x00, 0x00,   // 3
+    0x00, 0x00, 0x18, 0x20, 0x40, 0x78, 0x40, 0x20, 0x30, 0x00, 0x00, 0x00,   // 4
+    0x16, 0x0e, 0x10, 0x20, 0x40, 0x40, 0x38, 0x04, 0x18, 0x00, 0x00, 0x00,   // 5
+    0x00, 0x00, 0x00, 0x00, 0x2c, 0x52, 0x12, 0x12, 0x12, 0x02, 0x02, 0x02,   // 6
+    0x18, 0x24, 0x42, 0x42, 0x3e, 0x42, 0x42, 0x24, 0x18, 0x00, 0x00, 0x00,   // 7
+    0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x48, 0x30, 0x00, 0x00, 0x00,   // 8
+    0x00, 0x00, 0x40, 0x48, 0x50, 0x60, 0x50, 0x4a, 0x44, 0x00, 0x00, 0x00,   // 9
+    0x40, 0x20, 0x10, 0x10, 0x10, 0x10, 0x18, 0x24, 0x42, 0x00, 0x00, 0x00,   // 10
+    0x00, 0x00, 0x00, 0x00, 0x48, 0x48, 0x48, 0x48, 0x74, 0x40, 0x40, 0x40,   // 11
+    0x00, 0x00, 0x00, 0x62, 0x22, 0x24, 0x28, 0x30, 0x20, 0x00, 0x00, 0x00,   // 12
+    0x08, 0x1c, 0x20, 0x18, 0x20, 0x40, 0x3c, 0x02, 0x0c, 0x00, 0x00, 0x00,   // 13
+    0x00, 0x00, 0x00, 0x18, 0x24, 0x42, 0x42, 0x24, 0x18, 0x00, 0x00, 0x00,   // 14
+    0x00, 0x00, 0x00, 0x3f, 0x54, 0x24, 0x24, 0x24, 0x24, 0x00, 0x00, 0x00,   // 15
+    0x00, 0x00, 0x00, 0x18, 0x24, 0x42, 0x42, 0x64, 0x58, 0x40, 0x40, 0x40,   // 16
+    0x00, 0x00, 0x00, 0x1f, 0x24, 0x42, 0x42, 0x24, 0x18, 0x00, 0x00, 0x00,   // 17
+    0x00, 0x00, 0x00, 0x3f, 0x48, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,   // 18
+    0x00, 0x00, 0x00, 0x62, 0x24, 0x24, 0x24, 0x24, 0x18, 0x00, 0x00, 0x00,   // 19
+    0x10, 0x10, 0x38, 0x54, 0x54, 0x54, 0x38, 0x10, 0x10, 0x00, 0x00, 0x00,   // 20
+    0x00, 0x00, 0x00, 0x00, 0x62, 0x14, 0x08, 0x14, 0x23, 0x00, 0x00, 0x00,   // 21
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x2a, 0x2a, 0x2a, 0x1c, 0x08, 0x08, 0x08,   // 22
+    0x00, 0x00, 0x00, 0x22, 0x41, 0x49, 0x49, 0x49, 0x36, 0x00, 0x00, 0x00,   // 23
+    0x00, 0x1c, 0x22, 0x41, 0x41, 0x41, 0x22, 0x22, 0x63, 0x00, 0x00, 0x00,   // 24
+    0x0f, 0x10, 0x10, 0x10, 0x10, 0x10, 0x50, 0x30, 0x10, 0x00, 0x00, 0x00,   // 25
+    0x00, 0x00, 0x04, 0x02, 0x7f, 0x02, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,   // 26
+    0x00, 0x00, 0x10, 0x20, 0x7f, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,   // 27
+    0x08, 0x1c, 0x2a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 28
+    0x00, 0x00, 0x08, 0x00, 0x7f, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,   // 29
+    0x7f, 0x20, 0x10, 0x08, 0x06, 0x08, 0x10, 0x20, 0x7f, 0x00, 0x00, 0x00,   // 30
+    0x00, 0x30, 0x45, 0x06, 0x30, 0x45, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00,   // 31
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 32
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,   // 33
+    0x12, 0x12, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 34
+    0x14, 0x14, 0x14, 0x7f, 0x14, 0x7f, 0x14, 0x14, 0x14, 0x00, 0x00, 0x00,   // 35
+    0x08, 0x3f, 0x48, 0x48, 0x3e, 0x09, 0x09, 0x7e, 0x08, 0x00, 0x00, 0x00,   // 36
+    0x20, 0x51, 0x22, 0x04, 0x08, 0x10, 0x22, 0x45, 0x02, 0x00, 0x00, 0x00,   // 37
+    0x38, 0x44, 0x44, 0x28, 0x10, 0x29, 0x46, 0x46, 0x39, 0x00, 0x00, 0x00,   // 38
+    0x20, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 39
+    0x08, 0x10, 0x20, 0x20, 0x20, 0x20, 0x20, 0x10, 0x08, 0x00, 0x00, 0x00,   // 40
+    0x08, 0x04, 0x02, 0x02, 0x02, 0x02, 0x02, 0x04, 0x08, 0x00, 0x00, 0x00,   // 41
+    0x00, 0x00, 0x00, 0x00, 0x49, 0x2a, 0x1c, 0x7f, 0x1c, 0x2a, 0x49, 0x00,   // 42
+    0x00, 0x00, 0x00, 0x00, 0x7e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 43
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x10, 0x10, 0x20,   // 44
+    0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 45
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,   // 46
+    0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00,   // 47
+    0x3e, 0x41, 0x43, 0x45, 0x49, 0x51, 0x61, 0x41, 0x3e, 0x00, 0x00, 0x00,   // 48
+    0x08, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3e, 0x00, 0x00, 0x00,   // 49
+    0x3e, 0x41, 0x01, 0x02, 0x0c, 0x10, 0x20, 0x40, 0x7f, 0x00, 0x00, 0x00,   // 50
+    0x3e, 0x41, 0x01, 0x01, 0x1e, 0x01, 0x01, 0x41, 0x3e, 0x00, 0x00, 0x00,   // 51
+    0x02, 0x06, 0x0a, 0x12, 0x22, 0x7f, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00,   // 52
+    0x7f, 0x40, 0x40, 0x40, 0x7e, 0x01, 0x01, 0x41, 0x3e, 0x00, 0x00, 0x00,   // 53
+    0x3e, 0x41, 0x40, 0x40, 0x7e, 0x41, 0x41, 0x41, 0x3e, 0x00, 0x00, 0x00,   // 54
+    0x7f, 0x41, 0x02, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,   // 55
+    0x3e, 0x41, 0x41, 0x41, 0x3e, 0x41, 0x41, 0x41, 0x3e, 0x00, 0x00, 0x00,   // 56
+    0x3f, 0x41, 0x41, 0x41, 0x3f, 0x01, 0x01, 0x41, 0x3e, 0x00, 0x00, 0x00,   // 57
+    0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,   // 58
+    0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x30, 0x10, 0x10, 0x20,   // 59
+    0x04, 0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x04, 0x00, 0x00, 0x00,   // 60
+    0x00, 0x00, 0x00, 0x7f, 0x00, 0x7f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 61
+    0x10, 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00, 0x00,   // 62
+    0x3e, 0x41, 0x41, 0x02, 0x04, 0x08, 0x08, 0x00, 0x08, 0x00, 0x00, 0x00,   // 63
+    0x3e, 0x41, 0x41, 0x1d, 0x55, 0x5e, 0x40, 0x40, 0x3e, 0x00, 0x00, 0x00,   // 64
+    0x1c, 0x22, 0x41, 0x41, 0x7f, 0x41, 0x41, 0x41, 0x41, 0x00, 0x00, 0x00,   // 65
+    0x7e, 0x21, 0x21, 0x21, 0x3e, 0x21, 0x21, 0x21, 0x7e, 0x00, 0x00, 0x00,   // 66
+    0x1e, 0x21, 0x40, 0x40, 0x40, 0x40, 0x40, 0x21, 0x1e, 0x00, 0x00, 0x00,   // 67
+    0x7e, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x21, 0x7e, 0x00, 0x00, 0x00,   // 68
+    0x7f, 0x40, 0x40, 0x40, 0x78, 0x40, 0x40, 0x40, 0x7f, 0x00, 0x00, 0x00,   // 69
+    0x7f, 0x40, 0x40, 0x40, 0x78, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,   // 70
+    0x1e, 0x21, 0x40, 0x40, 0x40, 0x47, 0x41, 0x21, 0x1e, 0x00, 0x00, 0x00,   // 71
+    0x41, 0x41, 0x41, 0x41, 0x7f, 0x41, 0x41, 0x41, 0x41, 0x00, 0x00, 0x00,   // 72
+    0x3e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x3e, 0x00, 0x00, 0x00,   // 73
+    0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x44, 0x38, 0x00, 0x00, 0x00,   // 74
+    0x41, 0x42, 0x44, 0x48, 0x70, 0x48, 0x44, 0x42, 0x41, 0x00, 0x00, 0x00,   // 75
+    0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x7f, 0x00, 0x00, 0x00,   // 76
+    0x41, 0x63, 0x55, 0x49, 0x49, 0x41, 0x41, 0x41, 0x41, 0x00, 0x00, 0x00,   // 77
+    0x41, 0x61, 0x51, 0x49, 0x45, 0x43, 0x41, 0x41, 0x41, 0x00, 0x00, 0x00,   // 78
+    0x1c, 0x22, 0x41, 0x41, 0x41, 0x41, 0x41, 0x22, 0x1c, 0x00, 0x00, 0x00,   // 79
+    0x7e, 0x41, 0x41, 0x41, 0x7e, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,   // 80
+    0x1c, 0x22, 0x41, 0x41, 0x41, 0x41, 0x45, 0x22, 0x1d, 0x00, 0x00, 0x00,   // 81
+    0x7e, 0x41, 0x41, 0x41, 0x7e, 0x48, 0x44, 0x42, 0x41, 0x00, 0x00, 0x00,   // 82
+    0x3e, 0x41, 0x40, 0x40, 0x3e, 0x01, 0x01, 0x41, 0x3e, 0x00, 0x00, 0x00,   // 83
+    0x7f, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,   // 84
+    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x3e, 0x00, 0x00, 0x00,   // 85
+    0x41, 0x41, 0x41, 0x41, 0x41, 0x41, 0x22, 0x14, 0x08, 0x00, 0x00, 0x00,   // 86
+    0x41, 0x41, 0x41, 0x49, 0x49, 0x49, 0x55, 0x63, 0x41, 0x00, 0x00, 0x00,   // 87
+    0x41, 0x41, 0x22, 0x14, 0x08, 0x14, 0x22, 0x41, 0x41, 0x00, 0x00, 0x00,   // 88
+    0x41, 0x41, 0x22, 0x14, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,   // 89
+    0x7f, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x7f, 0x00, 0x00, 0x00,   // 90
+    0x1e, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1e, 0x00, 0x00, 0x00,   // 91
+    0x00, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00,   // 92
+    0x3c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x3c, 0x00, 0x00, 0x00,   // 93
+    0x3e, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 94
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x00,   // 95
+    0x02, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 96
+    0x00, 0x00, 0x00, 0x1e, 0x22, 0x42, 0x41, 0x46, 0x3a, 0x00, 0x00, 0x00,   // 97
+    0x40, 0x40, 0x40, 0x5c, 0x62, 0x42, 0x42, 0x62, 0x5c, 0x00, 0x00, 0x00,   // 98
+    0x00, 0x00, 0x00, 0x3c, 0x42, 0x40, 0x40, 0x42, 0x3c, 0x00, 0x00, 0x00,   // 99
+    0x02, 0x02, 0x02, 0x3a, 0x46, 0x42, 0x42, 0x46, 0x3a, 0x00, 0x00, 0x00,   // 100
+    0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x7e, 0x40, 0x3e, 0x00, 0x00, 0x00,   // 101
+    0x0c, 0x12, 0x10, 0x10, 0x7c, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,   // 102
+    0x00, 0x00, 0x00, 0x3a, 0x46, 0x42, 0x42, 0x46, 0x3a, 0x02, 0x42, 0x3c,   // 103
+    0x40, 0x40, 0x40, 0x58, 0x64, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00,   // 104
+    0x00, 0x08, 0x00, 0x18, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,   // 105
+    0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x42, 0x3c,   // 106
+    0x40, 0x40, 0x40, 0x44, 0x48, 0x70, 0x48, 0x44, 0x42, 0x00, 0x00, 0x00,   // 107
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00,   // 108
+    0x00, 0x00, 0x00, 0x76, 0x49, 0x49, 0x49, 0x49, 0x49, 0x00, 0x00, 0x00,   // 109
+    0x00, 0x00, 0x00, 0x5c, 0x62, 0x42, 0x42, 0x42, 0x42, 0x00, 0x00, 0x00,   // 110
+    0x00, 0x00, 0x00, 0x3c, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00,   // 111
+    0x00, 0x00, 0x00, 0x5c, 0x62, 0x42, 0x42, 0x62, 0x5c, 0x40, 0x40, 0x40,   // 112
+    0x00, 0x00, 0x00, 0x3a, 0x46, 0x42, 0x42, 0x46, 0x3a, 0x02, 0x02, 0x02,   // 113
+    0x00, 0x00, 0x00, 0x5c, 0x62, 0x40, 0x40, 0x40, 0x40, 0x00, 0x00, 0x00,   // 114
+    0x00, 0x00, 0x00, 0x3c, 0x42, 0x30, 0x0c, 0x42, 0x3c, 0x00, 0x00, 0x00,   // 115
+    0x00, 0x10, 0x10, 0x7c, 0x10, 0x01, 0x10, 0x12, 0x0c, 0x00, 0x00, 0x00,   // 116
+    0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x42, 0x3c, 0x00, 0x00, 0x00,   // 117
+    0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x28, 0x10, 0x00, 0x00, 0x00,   // 118
+    0x00, 0x00, 0x00, 0x41, 0x49, 0x49, 0x49, 0x49, 0x36, 0x00, 0x00, 0x00,   // 119
+    0x00, 0x00, 0x00, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x00, 0x00, 0x00,   // 120
+    0x00, 0x00, 0x00, 0x42, 0x42, 0x42, 0x42, 0x46, 0x3a, 0x02, 0x42, 0x3c,   // 121
+    0x00, 0x00, 0x00, 0x7e, 0x04, 0x08, 0x10, 0x20, 0x7e, 0x00, 0x00, 0x00,   // 122
+    0x0e, 0x10, 0x10, 0x10, 0x20, 0x10, 0x10, 0x10, 0x0e, 0x00, 0x00, 0x00,   // 123
+    0x10, 0x10, 0x10, 0x00, 0x00, 0x10, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00,   // 124
+    0x38, 0x04, 0x04, 0x04, 0x02, 0x04, 0x04, 0x04, 0x38, 0x00, 0x00, 0x00,   // 125
+    0x30, 0x49, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 126
+    0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x00, 0x00, 0x00,   // 127
+};
+
+static const uint16_t font_7x12_runs_index[129] = {
+      0,   10,   21,   29,   37,   44,   53,   58,   69,   72,
+     81,   89,   94,  101,  110,  118,  123,  132,  140,  143,
+    148,  155,  164,  171,  178,  187,  192,  197,  202,  207,
+    210,  219,  229,  229,  231,  233,  241,  250,  265,  278,
+    280,  285,  290,  303,  304,  307,  308,  309,  316,  327,
+    331,  340,  347,  355,  361,  368,  375,  382,  389,  391,
+    395,  404,  406,  415,  422,  431,  439,  446,  453,  457,
+    462,  466,  474,  479,  482,  486,  497,  499,  508,  517,
+    525,  530,  540,  549,  556,  558,  561,  568,  577,  590,
+    597,  606,  609,  616,  619,  622,  623,  625,  633,  641,
+    646,  654,  660,  665,  675,  681,  684,  687,  695,  696,
+    701,  706,  710,  718,  726,  731,  739,  746,  749,  754,
+    759,  768,  775,  781,  786,  788,  793,  798,  799,
+};
+
+static const uint16_t font_7x12_runs[799] = {
+    0x4221, 0x4711, 0x5113, 0x5411, 0x5611, 0x6511, 0x7411, 0x7611, 0x8221, 0x8711,   // 0
+    0x3241, 0x4211, 0x4611, 0x5231, 0x5621, 0x6212, 0x6612, 0x8231, 0x8621, 0x9212, 0xb111,   // 1
+    0x4121, 0x4711, 0x5312, 0x5611, 0x6511, 0x7321, 0x8311, 0x9223,   // 2
+    0x0221, 0x1113, 0x1411, 0x4211, 0x5221, 0x6112, 0x6412, 0x8221,   // 3
+    0x2321, 0x3211, 0x4111, 0x5141, 0x6111, 0x7211, 0x8221,   // 4
+    0x0311, 0x0521, 0x1431, 0x2311, 0x3211, 0x4112, 0x6231, 0x7511, 0x8321,   // 5
+    0x4211, 0x4421, 0x5111, 0x5314, 0x5617,   // 6
+    0x0321, 0x1211, 0x1511, 0x2112, 0x2612, 0x4251, 0x5112, 0x5612, 0x7211, 0x7511, 0x8321,   // 7
+    0x3115, 0x7411, 0x8221,   // 8
+    0x2113, 0x3411, 0x4311, 0x5121, 0x6113, 0x6311, 0x7411, 0x7611, 0x8511,   // 9
+    0x0111, 0x1211, 0x2314, 0x6321, 0x7211, 0x7511, 0x8111, 0x8611,   // 10
+    0x4114, 0x4414, 0x8131, 0x8511, 0x9113,   // 11
+    0x3121, 0x3612, 0x4213, 0x5511, 0x6411, 0x7221, 0x8211,   // 12
+    0x0411, 0x1331, 0x2211, 0x3321, 0x4211, 0x5111, 0x6241, 0x7611, 0x8421,   // 13
+    0x3321, 0x4211, 0x4511, 0x5112, 0x5612, 0x7211, 0x7511, 0x8321,   // 14
+    0x3261, 0x4111, 0x4311, 0x4515, 0x5214,   // 15
+    0x3321, 0x4211, 0x4511, 0x5112, 0x5612, 0x7121, 0x7511, 0x8114, 0x8321,   // 16
+    0x3351, 0x4211, 0x4511, 0x5112, 0x5612, 0x7211, 0x7511, 0x8321,   // 17
+    0x3261, 0x4111, 0x4415,   // 18
+    0x3121, 0x3611, 0x4214, 0x4514, 0x8321,   // 19
+    0x0312, 0x2231, 0x3113, 0x3313, 0x3513, 0x6231, 0x7312,   // 20
+    0x4121, 0x4611, 0x5311, 0x5511, 0x6411, 0x7311, 0x7511, 0x8211, 0x8621,   // 21
+    0x4111, 0x4414, 0x4711, 0x5213, 0x5613, 0x8331, 0x9413,   // 22
+    0x3211, 0x3611, 0x4114, 0x4714, 0x5413, 0x8221, 0x8521,   // 23
+    0x1331, 0x2211, 0x2611, 0x3113, 0x3713, 0x6212, 0x6612, 0x8121, 0x8621,   // 24
+    0x0441, 0x1316, 0x6111, 0x7221, 0x8311,   // 25
+    0x2511, 0x3611, 0x4171, 0x5611, 0x6511,   // 26
+    0x2311, 0x3211, 0x4171, 0x5211, 0x6311,   // 27
+    0x0411, 0x1331, 0x2211, 0x2411, 0x2611,   // 28
+    0x2411, 0x4171, 0x6411,   // 29
+    0x0171, 0x1211, 0x2311, 0x3411, 0x4521, 0x5411, 0x6311, 0x7211, 0x8171,   // 30
+    0x1221, 0x2111, 0x2511, 0x2711, 0x3521, 0x4221, 0x5111, 0x5511, 0x5711, 0x6521,   // 31
+    0x0416, 0x8411,   // 33
+    0x0313, 0x0613,   // 34
+    0x0313, 0x0513, 0x3171, 0x4311, 0x4511, 0x5171, 0x6313, 0x6513,   // 35
+    0x0411, 0x1261, 0x2112, 0x2412, 0x4251, 0x5412, 0x5712, 0x7161, 0x8411,   // 36
+    0x0211, 0x1111, 0x1311, 0x1711, 0x2211, 0x2611, 0x3511, 0x4411, 0x5311, 0x6211, 0x6611, 0x7111, 0x7511, 0x7711, 0x8611,   // 37
+    0x0231, 0x1112, 0x1512, 0x3211, 0x3411, 0x4311, 0x5211, 0x5411, 0x5711, 0x6112, 0x6522, 0x8231, 0x8711,   // 38
+    0x0212, 0x2111,   // 39
+    0x0411, 0x1311, 0x2215, 0x7311, 0x8411,   // 40
+    0x0411, 0x1511, 0x2615, 0x7511, 0x8411,   // 41
+    0x4111, 0x4412, 0x4711, 0x5211, 0x5611, 0x6331, 0x7171, 0x8331, 0x9211, 0x9412, 0x9611, 0xa111, 0xa711,   // 42
+    0x4161,   // 43
+    0x8221, 0x9312, 0xb211,   // 44
+    0x4171,   // 45
+    0x8311,   // 46
+    0x1711, 0x2611, 0x3511, 0x4411, 0x5311, 0x6211, 0x7111,   // 47
+    0x0251, 0x1115, 0x1711, 0x2621, 0x3511, 0x3715, 0x4411, 0x5311, 0x6121, 0x7111, 0x8251,   // 48
+    0x0411, 0x1321, 0x2416, 0x8251,   // 49
+    0x0251, 0x1111, 0x1712, 0x3611, 0x4421, 0x5311, 0x6211, 0x7111, 0x8171,   // 50
+    0x0251, 0x1111, 0x1713, 0x4341, 0x5713, 0x7111, 0x8251,   // 51
+    0x0611, 0x1521, 0x2411, 0x2613, 0x3311, 0x4211, 0x5171, 0x6613,   // 52
+    0x0171, 0x1113, 0x4161, 0x5713, 0x7111, 0x8251,   // 53
+    0x0251, 0x1113, 0x1711, 0x4161, 0x5113, 0x5713, 0x8251,   // 54
+    0x0171, 0x1111, 0x1711, 0x2611, 0x3511, 0x4411, 0x5314,   // 55
+    0x0251, 0x1113, 0x1713, 0x4251, 0x5113, 0x5713, 0x8251,   // 56
+    0x0261, 0x1113, 0x1713, 0x4261, 0x5713, 0x7111, 0x8251,   // 57
+    0x2211, 0x6211,   // 58
+    0x3211, 0x8221, 0x9312, 0xb211,   // 59
+    0x0511, 0x1411, 0x2311, 0x3211, 0x4111, 0x5211, 0x6311, 0x7411, 0x8511,   // 60
+    0x3171, 0x5171,   // 61
+    0x0311, 0x1411, 0x2511, 0x3611, 0x4711, 0x5611, 0x6511, 0x7411, 0x8311,   // 62
+    0x0251, 0x1112, 0x1712, 0x3611, 0x4511, 0x5412, 0x8411,   // 63
+    0x0251, 0x1112, 0x1714, 0x3331, 0x4114, 0x4311, 0x4511, 0x5341, 0x8251,   // 64
+    0x0331, 0x1211, 0x1611, 0x2112, 0x2712, 0x4171, 0x5114, 0x5714,   // 65
+    0x0161, 0x1213, 0x1713, 0x4251, 0x5213, 0x5713, 0x8161,   // 66
+    0x0341, 0x1211, 0x1711, 0x2115, 0x7211, 0x7711, 0x8341,   // 67
+    0x0161, 0x1217, 0x1717, 0x8161,   // 68
+    0x0171, 0x1113, 0x4141, 0x5113, 0x8171,   // 69
+    0x0171, 0x1113, 0x4141, 0x5114,   // 70
+    0x0341, 0x1211, 0x1711, 0x2115, 0x5531, 0x6712, 0x7211, 0x8341,   // 71
+    0x0114, 0x0714, 0x4171, 0x5114, 0x5714,   // 72
+    0x0251, 0x1417, 0x8251,   // 73
+    0x0351, 0x1517, 0x7111, 0x8231,   // 74
+    0x0114, 0x0711, 0x1611, 0x2511, 0x3411, 0x4131, 0x5114, 0x5411, 0x6511, 0x7611, 0x8711,   // 75
+    0x0118, 0x8171,   // 76
+    0x0111, 0x0711, 0x1121, 0x1621, 0x2117, 0x2311, 0x2511, 0x2717, 0x3412,   // 77
+    0x0111, 0x0715, 0x1121, 0x2117, 0x2311, 0x3411, 0x4511, 0x5621, 0x6713,   // 78
+    0x0331, 0x1211, 0x1611, 0x2115, 0x2715, 0x7211, 0x7611, 0x8331,   // 79
+    0x0161, 0x1113, 0x1713, 0x4161, 0x5114,   // 80
+    0x0331, 0x1211, 0x1611, 0x2115, 0x2715, 0x6511, 0x7211, 0x7611, 0x8331, 0x8711,   // 81
+    0x0161, 0x1113, 0x1713, 0x4161, 0x5114, 0x5411, 0x6511, 0x7611, 0x8711,   // 82
+    0x0251, 0x1113, 0x1711, 0x4251, 0x5713, 0x7111, 0x8251,   // 83
+    0x0171, 0x1418,   // 84
+    0x0118, 0x0718, 0x8251,   // 85
+    0x0116, 0x0716, 0x6211, 0x6611, 0x7311, 0x7511, 0x8411,   // 86
+    0x0117, 0x0717, 0x3413, 0x6311, 0x6511, 0x7121, 0x7621, 0x8111, 0x8711,   // 87
+    0x0112, 0x0712, 0x2211, 0x2611, 0x3311, 0x3511, 0x4411, 0x5311, 0x5511, 0x6211, 0x6611, 0x7112, 0x7712,   // 88
+    0x0112, 0x0712, 0x2211, 0x2611, 0x3311, 0x3511, 0x4415,   // 89
+    0x0171, 0x1711, 0x2611, 0x3511, 0x4411, 0x5311, 0x6211, 0x7111, 0x8171,   // 90
+    0x0341, 0x1317, 0x8341,   // 91
+    0x1111, 0x2211, 0x3311, 0x4411, 0x5511, 0x6611, 0x7711,   // 92
+    0x0241, 0x1517, 0x8241,   // 93
+    0x0251, 0x1111, 0x1711,   // 94
+    0x8171,   // 95
+    0x0612, 0x2711,   // 96
+    0x3341, 0x4211, 0x4612, 0x5113, 0x6711, 0x7521, 0x8231, 0x8611,   // 97
+    0x0114, 0x3331, 0x4121, 0x4614, 0x5112, 0x7121, 0x8111, 0x8331,   // 98
+    0x3241, 0x4114, 0x4611, 0x7611, 0x8241,   // 99
+    0x0614, 0x3231, 0x4114, 0x4521, 0x5612, 0x7521, 0x8231, 0x8611,   // 100
+    0x3241, 0x4112, 0x4612, 0x6161, 0x7111, 0x8251,   // 101
+    0x0421, 0x1313, 0x1611, 0x4151, 0x5314,   // 102
+    0x3231, 0x3611, 0x4114, 0x4521, 0x5612, 0x7521, 0x8231, 0x8613, 0xa111, 0xb241,   // 103
+    0x0114, 0x3321, 0x4121, 0x4511, 0x5114, 0x5614,   // 104
+    0x1411, 0x3321, 0x4415,   // 105
+    0x3618, 0xa111, 0xb241,   // 106
+    0x0115, 0x3511, 0x4411, 0x5131, 0x6113, 0x6411, 0x7511, 0x8611,   // 107
+    0x0319,   // 108
+    0x3131, 0x3521, 0x4115, 0x4415, 0x4715,   // 109
+    0x3111, 0x3331, 0x4121, 0x4615, 0x5114,   // 110
+    0x3241, 0x4114, 0x4614, 0x8241,   // 111
+    0x3111, 0x3331, 0x4121, 0x4614, 0x5112, 0x7121, 0x8114, 0x8331,   // 112
+    0x3231, 0x3611, 0x4114, 0x4521, 0x5612, 0x7521, 0x8231, 0x8614,   // 113
+    0x3111, 0x3331, 0x4121, 0x4611, 0x5114,   // 114
+    0x3241, 0x4111, 0x4611, 0x5221, 0x6421, 0x7111, 0x7611, 0x8241,   // 115
+    0x1312, 0x3151, 0x4311, 0x5711, 0x6312, 0x7611, 0x8421,   // 116
+    0x3115, 0x3615, 0x8241,   // 117
+    0x3114, 0x3514, 0x7211, 0x7411, 0x8311,   // 118
+    0x3115, 0x3715, 0x4414, 0x8221, 0x8521,   // 119
+    0x3111, 0x3611, 0x4211, 0x4511, 0x5322, 0x7211, 0x7511, 0x8111, 0x8611,   // 120
+    0x3115, 0x3614, 0x7521, 0x8231, 0x8613, 0xa111, 0xb241,   // 121
+    0x3161, 0x4511, 0x5411, 0x6311, 0x7211, 0x8161,   // 122
+    0x0431, 0x1313, 0x4211, 0x5313, 0x8431,   // 123
+    0x0313, 0x5313,   // 124
+    0x0231, 0x1513, 0x4611, 0x5513, 0x8231,   // 125
+    0x0221, 0x1111, 0x1411, 0x1711, 0x2521,   // 126
+    0x0179,   // 127
+};
+
+static const uint16_t font_7x12_aa[1536] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1f47, 0x35cd, 0x3030, 0x35cd, 0x1f47, 0x0000, 0x0000, 0x0000,   // 0
+    0x0000, 0x0000, 0x0000, 0x0bf4, 0x0c1d, 0x0fcf, 0x0d0d, 0x0d0d, 0x0fcb, 0x0d00, 0x1c00, 0x3400,   // 1
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3d07, 0x071d, 0x0334, 0x03d0, 0x0740, 0x0b00, 0x0f00, 0x0a00,   // 2
+    0x1f40, 0x35c0, 0x3000, 0x3400, 0x1d00, 0x1b40, 0x35c0, 0x35c0, 0x1f40, 0x0000, 0x0000, 0x0000,   // 3
+    0x0000, 0x0000, 0x07c0, 0x1d00, 0x3000, 0x3fc0, 0x3000, 0x1d00, 0x0b00, 0x0000, 0x0000, 0x0000,   // 4
+    0x0328, 0x00f8, 0x0740, 0x1d00, 0x3400, 0x3400, 0x1fd0, 0x0030, 0x03d0, 0x0000, 0x0000, 0x0000,   // 5
+    0x0000, 0x0000, 0x0000, 0x0000, 0x1cf4, 0x335c, 0x030c, 0x030c, 0x030c, 0x000c, 0x000c, 0x000c,   // 6
+    0x07d0, 0x1d74, 0x341c, 0x341c, 0x0ffc, 0x341c, 0x341c, 0x1d74, 0x07d0, 0x0000, 0x0000, 0x0000,   // 7
+    0x0000, 0x0000, 0x0000, 0x3000, 0x3000, 0x3000, 0x3000, 0x35c0, 0x1f40, 0x0000, 0x0000, 0x0000,   // 8
+    0x0000, 0x0000, 0x3000, 0x31c0, 0x3340, 0x3c00, 0x3340, 0x31cc, 0x3074, 0x0000, 0x0000, 0x0000,   // 9
+    0x3400, 0x1d00, 0x0700, 0x0300, 0x0300, 0x0340, 0x06d0, 0x1d74, 0x341c, 0x0000, 0x0000, 0x0000,   // 10
+    0x0000, 0x0000, 0x0000, 0x0000, 0x30c0, 0x30c0, 0x30c0, 0x35d0, 0x3f30, 0x3400, 0x3000, 0x3000,   // 11
+    0x0000, 0x0000, 0x0000, 0x380c, 0x1c1c, 0x0c74, 0x0cd0, 0x0f40, 0x0d00, 0x0000, 0x0000, 0x0000,   // 12
+    0x01d0, 0x07f0, 0x0c00, 0x03c0, 0x1d00, 0x3000, 0x1ff4, 0x000c, 0x00f4, 0x0000, 0x0000, 0x0000,   // 13
+    0x0000, 0x0000, 0x0000, 0x07d0, 0x1d74, 0x341c, 0x341c, 0x1d74, 0x07d0, 0x0000, 0x0000, 0x0000,   // 14
+    0x0000, 0x0000, 0x0000, 0x1fff, 0x3334, 0x1d30, 0x0c30, 0x0c30, 0x0c30, 0x0000, 0x0000, 0x0000,   // 15
+    0x0000, 0x0000, 0x0000, 0x07d0, 0x1d74, 0x341c, 0x341c, 0x3d74, 0x33d0, 0x3000, 0x3000, 0x3000,   // 16
+    0x0000, 0x0000, 0x0000, 0x07ff, 0x1d70, 0x341c, 0x341c, 0x1d74, 0x07d0, 0x0000, 0x0000, 0x0000,   // 17
+    0x0000, 0x0000, 0x0000, 0x1fff, 0x35d0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x0000, 0x0000, 0x0000,   // 18
+    0x0000, 0x0000, 0x0000, 0x381c, 0x1c34, 0x0c30, 0x0c30, 0x0d70, 0x07d0, 0x0000, 0x0000, 0x0000,   // 19
+    0x0300, 0x0740, 0x1fd0, 0x3330, 0x3330, 0x3330, 0x1fd0, 0x0740, 0x0300, 0x0000, 0x0000, 0x0000,   // 20
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3d1c, 0x0734, 0x00c0, 0x0734, 0x0d1f, 0x0000, 0x0000, 0x0000,   // 21
+    0x0000, 0x0000, 0x0000, 0x0000, 0x34c7, 0x1ccd, 0x0ccc, 0x0ccc, 0x07f4, 0x01d0, 0x00c0, 0x00c0,   // 22
+    0x0000, 0x0000, 0x0000, 0x1c0d, 0x3407, 0x30c3, 0x30c3, 0x35d7, 0x1f3d, 0x0000, 0x0000, 0x0000,   // 23
+    0x0000, 0x07f4, 0x1d1d, 0x3407, 0x3003, 0x3407, 0x1c0d, 0x1c0d, 0x380b, 0x0000, 0x0000, 0x0000,   // 24
+    0x01ff, 0x0340, 0x0300, 0x0300, 0x0300, 0x0300, 0x3300, 0x1f00, 0x0700, 0x0000, 0x0000, 0x0000,   // 25
+    0x0000, 0x0000, 0x0034, 0x000d, 0x3fff, 0x000d, 0x0034, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 26
+    0x0000, 0x0000, 0x0700, 0x1c00, 0x3fff, 0x1c00, 0x0700, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 27
+    0x01d0, 0x07f4, 0x0ccc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 28
+    0x0000, 0x0000, 0x00c0, 0x0000, 0x3fff, 0x0000, 0x00c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 29
+    0x3fff, 0x1c00, 0x0740, 0x01d0, 0x003c, 0x01d0, 0x0740, 0x1c00, 0x3fff, 0x0000, 0x0000, 0x0000,   // 30
+    0x0000, 0x1f00, 0x3433, 0x002d, 0x1f00, 0x3433, 0x002d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 31
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 32
+    0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x0000, 0x0000, 0x00c0, 0x0000, 0x0000, 0x0000,   // 33
+    0x030c, 0x030c, 0x030c, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 34
+    0x0330, 0x0330, 0x0734, 0x3fff, 0x0330, 0x3fff, 0x0734, 0x0330, 0x0330, 0x0000, 0x0000, 0x0000,   // 35
+    0x01d0, 0x1fff, 0x35d0, 0x35d0, 0x1ffd, 0x01d7, 0x01d7, 0x3ffd, 0x01d0, 0x0000, 0x0000, 0x0000,   // 36
+    0x1d00, 0x3307, 0x1d1d, 0x0074, 0x01d0, 0x0740, 0x1d1d, 0x3433, 0x001d, 0x0000, 0x0000, 0x0000,   // 37
+    0x1fd0, 0x3470, 0x3470, 0x1cd0, 0x0300, 0x1cd7, 0x3469, 0x3469, 0x1fd7, 0x0000, 0x0000, 0x0000,   // 38
+    0x0c00, 0x1c00, 0x3400, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 39
+    0x01c0, 0x0740, 0x0d00, 0x0c00, 0x0c00, 0x0c00, 0x0d00, 0x0740, 0x01c0, 0x0000, 0x0000, 0x0000,   // 40
+    0x00d0, 0x0074, 0x001c, 0x000c, 0x000c, 0x000c, 0x001c, 0x0074, 0x00d0, 0x0000, 0x0000, 0x0000,   // 41
+    0x0000, 0x0000, 0x0000, 0x0000, 0x34c7, 0x1ccd, 0x02e0, 0x3fff, 0x02e0, 0x1ccd, 0x34c7, 0x0000,   // 42
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3ffc, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 43
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e00, 0x0700, 0x0700, 0x0d00,   // 44
+    0x0000, 0x0000, 0x0000, 0x0000, 0x3fff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 45
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0300, 0x0000, 0x0000, 0x0000,   // 46
+    0x0000, 0x0007, 0x001d, 0x0074, 0x01d0, 0x0740, 0x1d00, 0x3400, 0x0000, 0x0000, 0x0000, 0x0000,   // 47
+    0x1ffd, 0x3403, 0x301f, 0x3073, 0x31d3, 0x3343, 0x3d03, 0x3007, 0x1ffd, 0x0000, 0x0000, 0x0000,   // 48
+    0x01c0, 0x03c0, 0x01c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01d0, 0x0ffc, 0x0000, 0x0000, 0x0000,   // 49
+    0x1ffd, 0x3407, 0x0007, 0x001d, 0x01f4, 0x0740, 0x1d00, 0x3000, 0x2fff, 0x0000, 0x0000, 0x0000,   // 50
+    0x1ffd, 0x3407, 0x0003, 0x0007, 0x03fc, 0x0007, 0x0003, 0x3407, 0x1ffd, 0x0000, 0x0000, 0x0000,   // 51
+    0x001c, 0x007c, 0x01cc, 0x074c, 0x1c1d, 0x3fff, 0x001d, 0x000c, 0x000c, 0x0000, 0x0000, 0x0000,   // 52
+    0x2fff, 0x3400, 0x3000, 0x3400, 0x2ffd, 0x0007, 0x0003, 0x3407, 0x1ffd, 0x0000, 0x0000, 0x0000,   // 53
+    0x1ffd, 0x3407, 0x3000, 0x3400, 0x3ffd, 0x3407, 0x3003, 0x3407, 0x1ffd, 0x0000, 0x0000, 0x0000,   // 54
+    0x2ffe, 0x3403, 0x001d, 0x0074, 0x01d0, 0x0340, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000, 0x0000,   // 55
+    0x1ffd, 0x3407, 0x3003, 0x3407, 0x0ffc, 0x3407, 0x3003, 0x3407, 0x1ffd, 0x0000, 0x0000, 0x0000,   // 56
+    0x1ffe, 0x3407, 0x3003, 0x3407, 0x1fff, 0x0007, 0x0003, 0x3407, 0x1ffd, 0x0000, 0x0000, 0x0000,   // 57
+    0x0000, 0x0000, 0x0c00, 0x0000, 0x0000, 0x0000, 0x0c00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 58
+    0x0000, 0x0000, 0x0000, 0x0c00, 0x0000, 0x0000, 0x0000, 0x0000, 0x0e00, 0x0700, 0x0700, 0x0d00,   // 59
+    0x0070, 0x01d0, 0x0740, 0x1d00, 0x3000, 0x1d00, 0x0740, 0x01d0, 0x0070, 0x0000, 0x0000, 0x0000,   // 60
+    0x0000, 0x0000, 0x0000, 0x3fff, 0x0000, 0x3fff, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 61
+    0x0340, 0x01d0, 0x0074, 0x001d, 0x0003, 0x001d, 0x0074, 0x01d0, 0x0340, 0x0000, 0x0000, 0x0000,   // 62
+    0x1ffd, 0x3407, 0x3007, 0x001d, 0x0074, 0x00d0, 0x00c0, 0x0000, 0x00c0, 0x0000, 0x0000, 0x0000,   // 63
+    0x1ffd, 0x3407, 0x3003, 0x02e3, 0x3333, 0x32fd, 0x3000, 0x3400, 0x1ffc, 0x0000, 0x0000, 0x0000,   // 64
+    0x07f4, 0x1d1d, 0x3407, 0x3407, 0x3fff, 0x3407, 0x3003, 0x3003, 0x3003, 0x0000, 0x0000, 0x0000,   // 65
+    0x3ffd, 0x1d07, 0x0c03, 0x0d07, 0x0ffc, 0x0d07, 0x0c03, 0x1d07, 0x3ffd, 0x0000, 0x0000, 0x0000,   // 66
+    0x07fd, 0x1d07, 0x3400, 0x3000, 0x3000, 0x3000, 0x3400, 0x1d07, 0x07fd, 0x0000, 0x0000, 0x0000,   // 67
+    0x3ffd, 0x1d07, 0x0c03, 0x0c03, 0x0c03, 0x0c03, 0x0c03, 0x1d07, 0x3ffd, 0x0000, 0x0000, 0x0000,   // 68
+    0x2fff, 0x3400, 0x3000, 0x3400, 0x3fc0, 0x3400, 0x3000, 0x3400, 0x2fff, 0x0000, 0x0000, 0x0000,   // 69
+    0x2fff, 0x3400, 0x3000, 0x3400, 0x3fc0, 0x3400, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000, 0x0000,   // 70
+    0x07fd, 0x1d07, 0x3400, 0x3000, 0x3000, 0x303e, 0x3407, 0x1d07, 0x07fd, 0x0000, 0x0000, 0x0000,   // 71
+    0x3003, 0x3003, 0x3003, 0x3407, 0x3fff, 0x3407, 0x3003, 0x3003, 0x3003, 0x0000, 0x0000, 0x0000,   // 72
+    0x0ffc, 0x01d0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x01d0, 0x0ffc, 0x0000, 0x0000, 0x0000,   // 73
+    0x03ff, 0x0074, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x3470, 0x1fd0, 0x0000, 0x0000, 0x0000,   // 74
+    0x3007, 0x301d, 0x3074, 0x35d0, 0x3f00, 0x35d0, 0x3074, 0x301d, 0x3007, 0x0000, 0x0000, 0x0000,   // 75
+    0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3000, 0x3400, 0x2fff, 0x0000, 0x0000, 0x0000,   // 76
+    0x3407, 0x3d1f, 0x3333, 0x31d3, 0x30c3, 0x3003, 0x3003, 0x3003, 0x3003, 0x0000, 0x0000, 0x0000,   // 77
+    0x3403, 0x3d03, 0x3343, 0x31d3, 0x3073, 0x301f, 0x3007, 0x3003, 0x3003, 0x0000, 0x0000, 0x0000,   // 78
+    0x07f4, 0x1d1d, 0x3407, 0x3003, 0x3003, 0x3003, 0x3407, 0x1d1d, 0x07f4, 0x0000, 0x0000, 0x0000,   // 79
+    0x2ffd, 0x3407, 0x3003, 0x3407, 0x3ffd, 0x3400, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000, 0x0000,   // 80
+    0x07f4, 0x1d1d, 0x3407, 0x3003, 0x3003, 0x3003, 0x3433, 0x1d0c, 0x07f3, 0x0000, 0x0000, 0x0000,   // 81
+    0x2ffd, 0x3407, 0x3003, 0x3407, 0x3ffd, 0x35c0, 0x3074, 0x301d, 0x3007, 0x0000, 0x0000, 0x0000,   // 82
+    0x1ffd, 0x3407, 0x3000, 0x3400, 0x1ffd, 0x0007, 0x0003, 0x3407, 0x1ffd, 0x0000, 0x0000, 0x0000,   // 83
+    0x3fff, 0x01d0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x0000, 0x0000, 0x0000,   // 84
+    0x3003, 0x3003, 0x3003, 0x3003, 0x3003, 0x3003, 0x3003, 0x3407, 0x1ffd, 0x0000, 0x0000, 0x0000,   // 85
+    0x3003, 0x3003, 0x3003, 0x3003, 0x3003, 0x3407, 0x1d1d, 0x0734, 0x01d0, 0x0000, 0x0000, 0x0000,   // 86
+    0x3003, 0x3003, 0x3003, 0x30c3, 0x30c3, 0x31d3, 0x3333, 0x3d1f, 0x3407, 0x0000, 0x0000, 0x0000,   // 87
+    0x3003, 0x3407, 0x1d1d, 0x0734, 0x00c0, 0x0734, 0x1d1d, 0x3407, 0x3003, 0x0000, 0x0000, 0x0000,   // 88
+    0x3003, 0x3407, 0x1d1d, 0x0734, 0x01d0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x0000, 0x0000, 0x0000,   // 89
+    0x3ffe, 0x0003, 0x001d, 0x0074, 0x01d0, 0x0740, 0x1d00, 0x3000, 0x2fff, 0x0000, 0x0000, 0x0000,   // 90
+    0x02fc, 0x0340, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0340, 0x02fc, 0x0000, 0x0000, 0x0000,   // 91
+    0x0000, 0x3400, 0x1d00, 0x0740, 0x01d0, 0x0074, 0x001d, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000,   // 92
+    0x0fe0, 0x0070, 0x0030, 0x0030, 0x0030, 0x0030, 0x0030, 0x0070, 0x0fe0, 0x0000, 0x0000, 0x0000,   // 93
+    0x1ffd, 0x3407, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 94
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x3fff, 0x0000, 0x0000, 0x0000,   // 95
+    0x000c, 0x000d, 0x0007, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 96
+    0x0000, 0x0000, 0x0000, 0x07f8, 0x1d1c, 0x340d, 0x3003, 0x3479, 0x1fcc, 0x0000, 0x0000, 0x0000,   // 97
+    0x3000, 0x3000, 0x3000, 0x33f4, 0x3d1c, 0x340c, 0x340c, 0x3d1c, 0x33f4, 0x0000, 0x0000, 0x0000,   // 98
+    0x0000, 0x0000, 0x0000, 0x1ff4, 0x341c, 0x3000, 0x3000, 0x341c, 0x1ff4, 0x0000, 0x0000, 0x0000,   // 99
+    0x000c, 0x000c, 0x000c, 0x1fcc, 0x347c, 0x301c, 0x301c, 0x347c, 0x1fcc, 0x0000, 0x0000, 0x0000,   // 100
+    0x0000, 0x0000, 0x0000, 0x1ff4, 0x341c, 0x341c, 0x3ff8, 0x3000, 0x1ffc, 0x0000, 0x0000, 0x0000,   // 101
+    0x01f4, 0x035c, 0x0300, 0x0740, 0x3ff0, 0x0740, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000, 0x0000,   // 102
+    0x0000, 0x0000, 0x0000, 0x1fcc, 0x347c, 0x301c, 0x301c, 0x347c, 0x1fcc, 0x000c, 0x341c, 0x1ff4,   // 103
+    0x3000, 0x3000, 0x3000, 0x33d0, 0x3d74, 0x341c, 0x300c, 0x300c, 0x300c, 0x0000, 0x0000, 0x0000,   // 104
+    0x0000, 0x00c0, 0x0000, 0x0380, 0x01c0, 0x00c0, 0x00c0, 0x00c0, 0x00c0, 0x0000, 0x0000, 0x0000,   // 105
+    0x0000, 0x0000, 0x0000, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x000c, 0x341c, 0x1ff4,   // 106
+    0x3000, 0x3000, 0x3000, 0x3070, 0x35d0, 0x3f00, 0x35d0, 0x3074, 0x301c, 0x0000, 0x0000, 0x0000,   // 107
+    0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000, 0x0000,   // 108
+    0x0000, 0x0000, 0x0000, 0x2f3d, 0x35d7, 0x30c3, 0x30c3, 0x30c3, 0x30c3, 0x0000, 0x0000, 0x0000,   // 109
+    0x0000, 0x0000, 0x0000, 0x33f4, 0x3d1c, 0x340c, 0x300c, 0x300c, 0x300c, 0x0000, 0x0000, 0x0000,   // 110
+    0x0000, 0x0000, 0x0000, 0x1ff4, 0x341c, 0x300c, 0x300c, 0x341c, 0x1ff4, 0x0000, 0x0000, 0x0000,   // 111
+    0x0000, 0x0000, 0x0000, 0x33f4, 0x3d1c, 0x340c, 0x340c, 0x3d1c, 0x33f4, 0x3000, 0x3000, 0x3000,   // 112
+    0x0000, 0x0000, 0x0000, 0x1fcc, 0x347c, 0x301c, 0x301c, 0x347c, 0x1fcc, 0x000c, 0x000c, 0x000c,   // 113
+    0x0000, 0x0000, 0x0000, 0x33f4, 0x3d1c, 0x3400, 0x3000, 0x3000, 0x3000, 0x0000, 0x0000, 0x0000,   // 114
+    0x0000, 0x0000, 0x0000, 0x1ff4, 0x301c, 0x1f40, 0x01f4, 0x340c, 0x1ff4, 0x0000, 0x0000, 0x0000,   // 115
+    0x0000, 0x0300, 0x0740, 0x3ff0, 0x0740, 0x0003, 0x0300, 0x035c, 0x01f4, 0x0000, 0x0000, 0x0000,   // 116
+    0x0000, 0x0000, 0x0000, 0x300c, 0x300c, 0x300c, 0x300c, 0x341c, 0x1ff4, 0x0000, 0x0000, 0x0000,   // 117
+    0x0000, 0x0000, 0x0000, 0x3030, 0x3030, 0x3030, 0x3470, 0x1cd0, 0x0740, 0x0000, 0x0000, 0x0000,   // 118
+    0x0000, 0x0000, 0x0000, 0x3003, 0x30c3, 0x30c3, 0x30c3, 0x35d7, 0x1f3d, 0x0000, 0x0000, 0x0000,   // 119
+    0x0000, 0x0000, 0x0000, 0x341c, 0x1d74, 0x0690, 0x0690, 0x1d74, 0x341c, 0x0000, 0x0000, 0x0000,   // 120
+    0x0000, 0x0000, 0x0000, 0x300c, 0x300c, 0x300c, 0x301c, 0x347c, 0x1fcc, 0x000c, 0x341c, 0x1ff4,   // 121
+    0x0000, 0x0000, 0x0000, 0x3ffc, 0x0034, 0x01d0, 0x0740, 0x1c00, 0x3ffc, 0x0000, 0x0000, 0x0000,   // 122
+    0x01fc, 0x0340, 0x0300, 0x0700, 0x0c00, 0x0700, 0x0300, 0x0340, 0x01fc, 0x0000, 0x0000, 0x0000,   // 123
+    0x0300, 0x0300, 0x0300, 0x0000, 0x0000, 0x0300, 0x0300, 0x0300, 0x0000, 0x0000, 0x0000, 0x0000,   // 124
+    0x0fd0, 0x0070, 0x0030, 0x0034, 0x000c, 0x0034, 0x0030, 0x0070, 0x0fd0, 0x0000, 0x0000, 0x0000,   // 125
+    0x1f40, 0x35d7, 0x007d, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 126
+    0x2ffe, 0x3fff, 0x3fff, 0x3fff, 0x3fff, 0x3fff, 0x3fff, 0x3fff, 0x2ffe, 0x0000, 0x0000, 0x0000,   // 127
+};
+
+const struct gfx_font gfx_font_7x12 = {
+    "7x12", 0, 8, 12, 9, 0, 127,
+    font_7x12_rows, font_7x12_runs_index, font_7x12_runs, font_7x12_aa
+};
+
+/* 5x7, 6 x 8 cells */
+static const uint8_t font_5x7_rows[2040] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 0
+    0x70, 0xf8, 0xa8, 0xf8, 0xd8, 0x88, 0x70, 0x00,   // 1
+    0x70, 0xf8, 0xa8, 0xf8, 0x88, 0xd8, 0x70, 0x00,   // 2
+    0x00, 0x50, 0xf8, 0xf8, 0xf8, 0x70, 0x20, 0x00,   // 3
+    0x00, 0x20, 0x70, 0xf8, 0xf8, 0x70, 0x20, 0x00,   // 4
+    0x70, 0x50, 0xf8, 0xa8, 0xf8, 0x20, 0x70, 0x00,   // 5
+    0x20, 0x70, 0xf8, 0xf8, 0xf8, 0x20, 0x70, 0x00,   // 6
+    0x00, 0x00, 0x20, 0x70, 0x70, 0x20, 0x00, 0x00,   // 7
+    0xf8, 0xf8, 0xd8, 0x88, 0x88, 0xd8, 0xf8, 0xf8,   // 8
+    0x00, 0x00, 0x20, 0x50, 0x50, 0x20, 0x00, 0x00,   // 9
+    0xf8, 0xf8, 0xd8, 0xa8, 0xa8, 0xd8, 0xf8, 0xf8,   // 10
+    0x00, 0x38, 0x18, 0x68, 0xa0, 0xa0, 0x40, 0x00,   // 11
+    0x70, 0x88, 0x88, 0x70, 0x20, 0xf8, 0x20, 0x00,   // 12
+    0x78, 0x48, 0x78, 0x40, 0x40, 0x40, 0xc0, 0x00,   // 13
+    0x78, 0x48, 0x78, 0x48, 0x48, 0x58, 0xc0, 0x00,   // 14
+    0x20, 0xa8, 0x70, 0xd8, 0xd8, 0x70, 0xa8, 0x20,   // 15
+    0x80, 0xc0, 0xf0, 0xf8, 0xf0, 0xc0, 0x80, 0x00,   // 16
+    0x08, 0x18, 0x78, 0xf8, 0x78, 0x18, 0x08, 0x00,   // 17
+    0x20, 0x70, 0xa8, 0x20, 0xa8, 0x70, 0x20, 0x00,   // 18
+    0xd8, 0xd8, 0xd8, 0xd8, 0xd8, 0x00, 0xd8, 0x00,   // 19
+    0x78, 0xa8, 0xa8, 0x68, 0x28, 0x28, 0x28, 0x00,   // 20
+    0x30, 0x48, 0x50, 0x28, 0x10, 0x48, 0x48, 0x30,   // 21
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0x00,   // 22
+    0x20, 0x70, 0xa8, 0x20, 0xa8, 0x70, 0x20, 0xf8,   // 23
+    0x00, 0x20, 0x70, 0xa8, 0x20, 0x20, 0x20, 0x00,   // 24
+    0x00, 0x20, 0x20, 0x20, 0xa8, 0x70, 0x20, 0x00,   // 25
+    0x00, 0x20, 0x10, 0xf8, 0x10, 0x20, 0x00, 0x00,   // 26
+    0x00, 0x20, 0x40, 0xf8, 0x40, 0x20, 0x00, 0x00,   // 27
+    0x00, 0x80, 0x80, 0x80, 0xf8, 0x00, 0x00, 0x00,   // 28
+    0x00, 0x50, 0xf8, 0xf8, 0x50, 0x00, 0x00, 0x00,   // 29
+    0x00, 0x20, 0x20, 0x70, 0xf8, 0xf8, 0x00, 0x00,   // 30
+    0x00, 0xf8, 0xf8, 0x70, 0x20, 0x20, 0x00, 0x00,   // 31
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 32
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x20, 0x00,   // 33
+    0x50, 0x50, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00,   // 34
+    0x50, 0x50, 0xf8, 0x50, 0xf8, 0x50, 0x50, 0x00,   // 35
+    0x20, 0x78, 0xa0, 0x70, 0x28, 0xf0, 0x20, 0x00,   // 36
+    0xc0, 0xc8, 0x10, 0x20, 0x40, 0x98, 0x18, 0x00,   // 37
+    0x40, 0xa0, 0xa0, 0x40, 0xa8, 0x90, 0x68, 0x00,   // 38
+    0x30, 0x30, 0x20, 0x40, 0x00, 0x00, 0x00, 0x00,   // 39
+    0x10, 0x20, 0x40, 0x40, 0x40, 0x20, 0x10, 0x00,   // 40
+    0x40, 0x20, 0x10, 0x10, 0x10, 0x20, 0x40, 0x00,   // 41
+    0x20, 0xa8, 0x70, 0xf8, 0x70, 0xa8, 0x20, 0x00,   // 42
+    0x00, 0x20, 0x20, 0xf8, 0x20, 0x20, 0x00, 0x00,   // 43
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x20, 0x40,   // 44
+    0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00, 0x00,   // 45
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00,   // 46
+    0x00, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00,   // 47
+    0x70, 0x88, 0x98, 0xa8, 0xc8, 0x88, 0x70, 0x00,   // 48
+    0x20, 0x60, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00,   // 49
+    0x70, 0x88, 0x08, 0x70, 0x80, 0x80, 0xf8, 0x00,   // 50
+    0xf8, 0x08, 0x10, 0x30, 0x08, 0x88, 0x70, 0x00,   // 51
+    0x10, 0x30, 0x50, 0x90, 0xf8, 0x10, 0x10, 0x00,   // 52
+    0xf8, 0x80, 0xf0, 0x08, 0x08, 0x88, 0x70, 0x00,   // 53
+    0x38, 0x40, 0x80, 0xf0, 0x88, 0x88, 0x70, 0x00,   // 54
+    0xf8, 0x08, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00,   // 55
+    0x70, 0x88, 0x88, 0x70, 0x88, 0x88, 0x70, 0x00,   // 56
+    0x70, 0x88, 0x88, 0x78, 0x08, 0x10, 0xe0, 0x00,   // 57
+    0x00, 0x00, 0x20, 0x00, 0x20, 0x00, 0x00, 0x00,   // 58
+    0x00, 0x00, 0x20, 0x00, 0x20, 0x20, 0x40, 0x00,   // 59
+    0x08, 0x10, 0x20, 0x40, 0x20, 0x10, 0x08, 0x00,   // 60
+    0x00, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x00, 0x00,   // 61
+    0x40, 0x20, 0x10, 0x08, 0x10, 0x20, 0x40, 0x00,   // 62
+    0x70, 0x88, 0x08, 0x30, 0x20, 0x00, 0x20, 0x00,   // 63
+    0x70, 0x88, 0xa8, 0xb8, 0xb0, 0x80, 0x78, 0x00,   // 64
+    0x20, 0x50, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x00,   // 65
+    0xf0, 0x88, 0x88, 0xf0, 0x88, 0x88, 0xf0, 0x00,   // 66
+    0x70, 0x88, 0x80, 0x80, 0x80, 0x88, 0x70, 0x00,   // 67
+    0xf0, 0x88, 0x88, 0x88, 0x88, 0x88, 0xf0, 0x00,   // 68
+    0xf8, 0x80, 0x80, 0xf0, 0x80, 0x80, 0xf8, 0x00,   // 69
+    0xf8, 0x80, 0x80, 0xf0, 0x80, 0x80, 0x80, 0x00,   // 70
+    0x78, 0x88, 0x80, 0x80, 0x98, 0x88, 0x78, 0x00,   // 71
+    0x88, 0x88, 0x88, 0xf8, 0x88, 0x88, 0x88, 0x00,   // 72
+    0x70, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00,   // 73
+    0x38, 0x10, 0x10, 0x10, 0x10, 0x90, 0x60, 0x00,   // 74
+    0x88, 0x90, 0xa0, 0xc0, 0xa0, 0x90, 0x88, 0x00,   // 75
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xf8, 0x00,   // 76
+    0x88, 0xd8, 0xa8, 0xa8, 0xa8, 0x88, 0x88, 0x00,   // 77
+    0x88, 0x88, 0xc8, 0xa8, 0x98, 0x88, 0x88, 0x00,   // 78
+    0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00,   // 79
+    0xf0, 0x88, 0x88, 0xf0, 0x80, 0x80, 0x80, 0x00,   // 80
+    0x70, 0x88, 0x88, 0x88, 0xa8, 0x90, 0x68, 0x00,   // 81
+    0xf0, 0x88, 0x88, 0xf0, 0xa0, 0x90, 0x88, 0x00,   // 82
+    0x70, 0x88, 0x80, 0x70, 0x08, 0x88, 0x70, 0x00,   // 83
+    0xf8, 0xa8, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00,   // 84
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00,   // 85
+    0x88, 0x88, 0x88, 0x88, 0x88, 0x50, 0x20, 0x00,   // 86
+    0x88, 0x88, 0x88, 0xa8, 0xa8, 0xa8, 0x50, 0x00,   // 87
+    0x88, 0x88, 0x50, 0x20, 0x50, 0x88, 0x88, 0x00,   // 88
+    0x88, 0x88, 0x50, 0x20, 0x20, 0x20, 0x20, 0x00,   // 89
+    0xf8, 0x08, 0x10, 0x70, 0x40, 0x80, 0xf8, 0x00,   // 90
+    0x78, 0x40, 0x40, 0x40, 0x40, 0x40, 0x78, 0x00,   // 91
+    0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x00, 0x00,   // 92
+    0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x78, 0x00,   // 93
+    0x20, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00,   // 94
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x00,   // 95
+    0x60, 0x60, 0x20, 0x10, 0x00, 0x00, 0x00, 0x00,   // 96
+    0x00, 0x00, 0x60, 0x10, 0x70, 0x90, 0x78, 0x00,   // 97
+    0x80, 0x80, 0xb0, 0xc8, 0x88, 0xc8, 0xb0, 0x00,   // 98
+    0x00, 0x00, 0x70, 0x88, 0x80, 0x88, 0x70, 0x00,   // 99
+    0x08, 0x08, 0x68, 0x98, 0x88, 0x98, 0x68, 0x00,   // 100
+    0x00, 0x00, 0x70, 0x88, 0xf8, 0x80, 0x70, 0x00,   // 101
+    0x10, 0x28, 0x20, 0x70, 0x20, 0x20, 0x20, 0x00,   // 102
+    0x00, 0x00, 0x70, 0x98, 0x98, 0x68, 0x08, 0x70,   // 103
+    0x80, 0x80, 0xb0, 0xc8, 0x88, 0x88, 0x88, 0x00,   // 104
+    0x20, 0x00, 0x60, 0x20, 0x20, 0x20, 0x70, 0x00,   // 105
+    0x10, 0x00, 0x10, 0x10, 0x10, 0x90, 0x60, 0x00,   // 106
+    0x80, 0x80, 0x90, 0xa0, 0xc0, 0xa0, 0x90, 0x00,   // 107
+    0x60, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x00,   // 108
+    0x00, 0x00, 0xd0, 0xa8, 0xa8, 0xa8, 0xa8, 0x00,   // 109
+    0x00, 0x00, 0xb0, 0xc8, 0x88, 0x88, 0x88, 0x00,   // 110
+    0x00, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00,   // 111
+    0x00, 0x00, 0xb0, 0xc8, 0xc8, 0xb0, 0x80, 0x80,   // 112
+    0x00, 0x00, 0x68, 0x98, 0x98, 0x68, 0x08, 0x08,   // 113
+    0x00, 0x00, 0xb0, 0xc8, 0x80, 0x80, 0x80, 0x00,   // 114
+    0x00, 0x00, 0x78, 0x80, 0x70, 0x08, 0xf0, 0x00,   // 115
+    0x20, 0x20, 0xf8, 0x20, 0x20, 0x28, 0x10, 0x00,   // 116
+    0x00, 0x00, 0x88, 0x88, 0x88, 0x98, 0x68, 0x00,   // 117
+    0x00, 0x00, 0x88, 0x88, 0x88, 0x50, 0x20, 0x00,   // 118
+    0x00, 0x00, 0x88, 0x88, 0xa8, 0xa8, 0x50, 0x00,   // 119
+    0x00, 0x00, 0x88, 0x50, 0x20, 0x50, 0x88, 0x00,   // 120
+    0x00, 0x00, 0x88, 0x88, 0x78, 0x08, 0x88, 0x70,   // 121
+    0x00, 0x00, 0xf8, 0x10, 0x20, 0x40, 0xf8, 0x00,   // 122
+    0x10, 0x20, 0x20, 0x40, 0x20, 0x20, 0x10, 0x00,   // 123
+    0x20, 0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x00,   // 124
+    0x40, 0x20, 0x20, 0x10, 0x20, 0x20, 0x40, 0x00,   // 125
+    0x40, 0xa8, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,   // 126
+    0x20, 0x70, 0xd8, 0x88, 0x88, 0xf8, 0x00, 0x00,   // 127
+    0x70, 0x88, 0x80, 0x80, 0x88, 0x70, 0x10, 0x60,   // 128
+    0x00, 0x88, 0x00, 0x88, 0x88, 0x98, 0x68, 0x00,   // 129
+    0x18, 0x00, 0x70, 0x88, 0xf8, 0x80, 0x78, 0x00,   // 130
+    0xf8, 0x00, 0x60, 0x10, 0x70, 0x90, 0x78, 0x00,   // 131
+    0x88, 0x00, 0x60, 0x10, 0x70, 0x90, 0x78, 0x00,   // 132
+    0xc0, 0x00, 0x60, 0x10, 0x70, 0x90, 0x78, 0x00,   // 133
+    0x30, 0x00, 0x60, 0x10, 0x70, 0x90, 0x78, 0x00,   // 134
+    0x00, 0x78, 0xc0, 0xc0, 0x78, 0x10, 0x30, 0x00,   // 135
+    0xf8, 0x00, 0x70, 0x88, 0xf8, 0x80, 0x78, 0x00,   // 136
+    0x88, 0x00, 0x70, 0x88, 0xf8, 0x80, 0x78, 0x00,   // 137
+    0xc0, 0x00, 0x70, 0x88, 0xf8, 0x80, 0x78, 0x00,   // 138
+    0x28, 0x00, 0x30, 0x10, 0x10, 0x10, 0x38, 0x00,   // 139
+    0x30, 0x48, 0x30, 0x10, 0x10, 0x10, 0x38, 0x00,   // 140
+    0x60, 0x00, 0x30, 0x10, 0x10, 0x10, 0x38, 0x00,   // 141
+    0x50, 0x00, 0x20, 0x50, 0x88, 0xf8, 0x88, 0x88,   // 142
+    0x20, 0x00, 0x20, 0x50, 0x88, 0xf8, 0x88, 0x88,   // 143
+    0x30, 0x00, 0xf0, 0x80, 0xe0, 0x80, 0xf0, 0x00,   // 144
+    0x00, 0x00, 0x78, 0x10, 0x78, 0x90, 0x78, 0x00,   // 145
+    0x38, 0x50, 0x90, 0xf8, 0x90, 0x90, 0x98, 0x00,   // 146
+    0x70, 0x88, 0x00, 0x70, 0x88, 0x88, 0x70, 0x00,   // 147
+    0x00, 0x88, 0x00, 0x70, 0x88, 0x88, 0x70, 0x00,   // 148
+    0x00, 0xc0, 0x00, 0x70, 0x88, 0x88, 0x70, 0x00,   // 149
+    0x70, 0x88, 0x00, 0x88, 0x88, 0x98, 0x68, 0x00,   // 150
+    0x00, 0xc0, 0x00, 0x88, 0x88, 0x98, 0x68, 0x00,   // 151
+    0x48, 0x00, 0x48, 0x48, 0x48, 0x38, 0x08, 0x70,   // 152
+    0x88, 0x00, 0x70, 0x88, 0x88, 0x88, 0x70, 0x00,   // 153
+    0x88, 0x00, 0x88, 0x88, 0x88, 0x88, 0x70, 0x00,   // 154
+    0x20, 0x20, 0xf8, 0xa0, 0xa0, 0xf8, 0x20, 0x20,   // 155
+    0x30, 0x58, 0x48, 0xe0, 0x40, 0x48, 0xf8, 0x00,   // 156
+    0xd8, 0xd8, 0x70, 0xf8, 0x20, 0xf8, 0x20, 0x20,   // 157
+    0xe0, 0x90, 0x90, 0xe0, 0x90, 0xb8, 0x90, 0x90,   // 158
+    0x18, 0x28, 0x20, 0x70, 0x20, 0x20, 0xa0, 0xc0,   // 159
+    0x18, 0x00, 0x60, 0x10, 0x70, 0x90, 0x78, 0x00,   // 160
+    0x18, 0x00, 0x30, 0x10, 0x10, 0x10, 0x38, 0x00,   // 161
+    0x00, 0x18, 0x00, 0x70, 0x88, 0x88, 0x70, 0x00,   // 162
+    0x00, 0x18, 0x00, 0x88, 0x88, 0x98, 0x68, 0x00,   // 163
+    0x00, 0x78, 0x00, 0x70, 0x48, 0x48, 0x48, 0x00,   // 164
+    0xf8, 0x00, 0xc8, 0xe8, 0xb8, 0x98, 0x88, 0x00,   // 165
+    0x70, 0x90, 0x90, 0x78, 0x00, 0xf8, 0x00, 0x00,   // 166
+    0x70, 0x88, 0x88, 0x70, 0x00, 0xf8, 0x00, 0x00,   // 167
+    0x20, 0x00, 0x20, 0x60, 0x80, 0x88, 0x70, 0x00,   // 168
+    0x00, 0x00, 0x00, 0xf8, 0x80, 0x80, 0x00, 0x00,   // 169
+    0x00, 0x00, 0x00, 0xf8, 0x08, 0x08, 0x00, 0x00,   // 170
+    0x80, 0x88, 0x90, 0xb8, 0x48, 0x98, 0x20, 0x38,   // 171
+    0x80, 0x88, 0x90, 0xa8, 0x58, 0xb8, 0x08, 0x08,   // 172
+    0x20, 0x20, 0x00, 0x20, 0x20, 0x20, 0x20, 0x00,   // 173
+    0x00, 0x28, 0x50, 0xa0, 0x50, 0x28, 0x00, 0x00,   // 174
+    0x00, 0xa0, 0x50, 0x28, 0x50, 0xa0, 0x00, 0x00,   // 175
+    0x20, 0x88, 0x20, 0x88, 0x20, 0x88, 0x20, 0x88,   // 176
+    0x50, 0xa8, 0x50, 0xa8, 0x50, 0xa8, 0x50, 0xa8,   // 177
+    0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,   // 178
+    0x10, 0x10, 0x10, 0x10, 0xf0, 0x10, 0x10, 0x10,   // 179
+    0x10, 0x10, 0xf0, 0x10, 0xf0, 0x10, 0x10, 0x10,   // 180
+    0x28, 0x28, 0x28, 0x28, 0xe8, 0x28, 0x28, 0x28,   // 181
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x28, 0x28, 0x28,   // 182
+    0x00, 0x00, 0xf0, 0x10, 0xf0, 0x10, 0x10, 0x10,   // 183
+    0x28, 0x28, 0xe8, 0x08, 0xe8, 0x28, 0x28, 0x28,   // 184
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,   // 185
+    0x00, 0x00, 0xf8, 0x08, 0xe8, 0x28, 0x28, 0x28,   // 186
+    0x28, 0x28, 0xe8, 0x08, 0xf8, 0x00, 0x00, 0x00,   // 187
+    0x28, 0x28, 0x28, 0x28, 0xf8, 0x00, 0x00, 0x00,   // 188
+    0x10, 0x10, 0xf0, 0x10, 0xf0, 0x00, 0x00, 0x00,   // 189
+    0x00, 0x00, 0x00, 0x00, 0xf0, 0x10, 0x10, 0x10,   // 190
+    0x10, 0x10, 0x10, 0x10, 0x18, 0x00, 0x00, 0x00,   // 191
+    0x10, 0x10, 0x10, 0x10, 0xf8, 0x00, 0x00, 0x00,   // 192
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x10, 0x10, 0x10,   // 193
+    0x10, 0x10, 0x10, 0x10, 0x18, 0x10, 0x10, 0x10,   // 194
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x00, 0x00, 0x00,   // 195
+    0x10, 0x10, 0x10, 0x10, 0xf8, 0x10, 0x10, 0x10,   // 196
+    0x10, 0x10, 0x18, 0x10, 0x18, 0x10, 0x10, 0x10,   // 197
+    0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28, 0x28,   // 198
+    0x28, 0x28, 0x28, 0x20, 0x38, 0x00, 0x00, 0x00,   // 199
+    0x00, 0x00, 0x38, 0x20, 0x28, 0x28, 0x28, 0x28,   // 200
+    0x28, 0x28, 0xe8, 0x00, 0xf8, 0x00, 0x00, 0x00,   // 201
+    0x00, 0x00, 0xf8, 0x00, 0xe8, 0x28, 0x28, 0x28,   // 202
+    0x28, 0x28, 0x28, 0x20, 0x28, 0x28, 0x28, 0x28,   // 203
+    0x00, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x00, 0x00,   // 204
+    0x28, 0x28, 0xe8, 0x00, 0xe8, 0x28, 0x28, 0x28,   // 205
+    0x10, 0x10, 0xf8, 0x00, 0xf8, 0x00, 0x00, 0x00,   // 206
+    0x28, 0x28, 0x28, 0x28, 0xf8, 0x00, 0x00, 0x00,   // 207
+    0x00, 0x00, 0xf8, 0x00, 0xf8, 0x10, 0x10, 0x10,   // 208
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0x28, 0x28, 0x28,   // 209
+    0x28, 0x28, 0x28, 0x28, 0x38, 0x00, 0x00, 0x00,   // 210
+    0x10, 0x10, 0x18, 0x10, 0x18, 0x00, 0x00, 0x00,   // 211
+    0x00, 0x00, 0x18, 0x10, 0x18, 0x10, 0x10, 0x10,   // 212
+    0x00, 0x00, 0x00, 0x00, 0x38, 0x28, 0x28, 0x28,   // 213
+    0x28, 0x28, 0x28, 0x28, 0xf8, 0x28, 0x28, 0x28,   // 214
+    0x10, 0x10, 0xf8, 0x10, 0xf8, 0x10, 0x10, 0x10,   // 215
+    0x10, 0x10, 0x10, 0x10, 0xf0, 0x00, 0x00, 0x00,   // 216
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x10, 0x10, 0x10,   // 217
+    0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8, 0xf8,   // 218
+    0x00, 0x00, 0x00, 0x00, 0xf8, 0xf8, 0xf8, 0xf8,   // 219
+    0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,   // 220
+    0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,   // 221
+    0xf8, 0xf8, 0xf8, 0xf8, 0x00, 0x00, 0x00, 0x00,   // 222
+    0x00, 0x00, 0x68, 0x90, 0x90, 0x90, 0x68, 0x00,   // 223
+    0x00, 0x70, 0x98, 0xf0, 0x98, 0xf0, 0x80, 0x00,   // 224
+    0x00, 0xf8, 0x98, 0x80, 0x80, 0x80, 0x80, 0x00,   // 225
+    0x00, 0xf8, 0x50, 0x50, 0x50, 0x50, 0x50, 0x00,   // 226
+    0xf8, 0x88, 0x40, 0x20, 0x40, 0x88, 0xf8, 0x00,   // 227
+    0x00, 0x00, 0x78, 0x90, 0x90, 0x90, 0x60, 0x00,   // 228
+    0x00, 0x50, 0x50, 0x50, 0x50, 0x68, 0xc0, 0x00,   // 229
+    0x00, 0xf8, 0xa0, 0x20, 0x20, 0x20, 0x20, 0x00,   // 230
+    0xf8, 0x20, 0x70, 0x88, 0x88, 0x70, 0x20, 0xf8,   // 231
+    0x20, 0x50, 0x88, 0xf8, 0x88, 0x50, 0x20, 0x00,   // 232
+    0x20, 0x50, 0x88, 0x88, 0x50, 0x50, 0xd8, 0x00,   // 233
+    0x30, 0x40, 0x30, 0x70, 0x88, 0x88, 0x70, 0x00,   // 234
+    0x00, 0x00, 0x00, 0x70, 0xa8, 0xa8, 0x70, 0x00,   // 235
+    0x08, 0x70, 0x98, 0xa8, 0xa8, 0xc8, 0x70, 0x80,   // 236
+    0x70, 0x80, 0x80, 0xf0, 0x80, 0x80, 0x70, 0x00,   // 237
+    0x70, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x00,   // 238
+    0x00, 0xf8, 0x00, 0xf8, 0x00, 0xf8, 0x00, 0x00,   // 239
+    0x20, 0x20, 0xf8, 0x20, 0x20, 0x00, 0xf8, 0x00,   // 240
+    0x40, 0x20, 0x10, 0x20, 0x40, 0x00, 0xf8, 0x00,   // 241
+    0x10, 0x20, 0x40, 0x20, 0x10, 0x00, 0xf8, 0x00,   // 242
+    0x38, 0x28, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,   // 243
+    0x20, 0x20, 0x20, 0x20, 0x20, 0xa0, 0xa0, 0xe0,   // 244
+    0x30, 0x30, 0x00, 0xf8, 0x00, 0x30, 0x30, 0x00,   // 245
+    0x00, 0xe8, 0xb8, 0x00, 0xe8, 0xb8, 0x00, 0x00,   // 246
+    0x70, 0xd8, 0xd8, 0x70, 0x00, 0x00, 0x00, 0x00,   // 247
+    0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00,   // 248
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,   // 249
+    0x38, 0x20, 0x20, 0x20, 0xa0, 0xa0, 0x60, 0x20,   // 250
+    0x70, 0x48, 0x48, 0x48, 0x48, 0x00, 0x00, 0x00,   // 251
+    0x70, 0x18, 0x30, 0x60, 0x78, 0x00, 0x00, 0x00,   // 252
+    0x00, 0x00, 0x78, 0x78, 0x78, 0x78, 0x00, 0x00,   // 253
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,   // 254
+};
+
+static const uint16_t font_5x7_runs_index[256] = {
+      0,    0,   11,   22,   27,   32,   42,   47,   50,   58,
+     62,   71,   78,   85,   91,   99,  109,  116,  123,  132,
+    136,  142,  152,  153,  163,  168,  173,  178,  183,  185,
+    190,  193,  196,  196,  198,  200,  208,  217,  224,  234,
+    237,  242,  247,  256,  259,  262,  263,  264,  269,  278,
+    282,  288,  295,  302,  308,  315,  321,  328,  335,  337,
+    340,  347,  349,  356,  362,  369,  377,  384,  389,  393,
+    398,  402,  408,  413,  416,  420,  429,  431,  438,  445,
+    449,  454,  461,  469,  476,  480,  483,  488,  493,  502,
+    507,  514,  517,  522,  525,  530,  531,  534,  540,  548,
+    553,  561,  567,  572,  578,  583,  587,  591,  598,  601,
+    606,  611,  615,  621,  627,  632,  637,  642,  647,  652,
+    657,  666,  672,  677,  682,  684,  689,  694,  701,  708,
+    715,  722,  729,  737,  744,  751,  756,  763,  771,  778,
+    783,  789,  793,  803,  812,  818,  824,  832,  839,  845,
+    850,  858,  864,  871,  877,  882,  888,  896,  903,  911,
+    918,  925,  929,  934,  940,  944,  952,  957,  962,  968,
+    970,  972,  982,  992,  994, 1004, 1014, 1026, 1046, 1047,
+   1050, 1055, 1059, 1062, 1066, 1071, 1073, 1077, 1081, 1084,
+   1088, 1090, 1092, 1094, 1096, 1099, 1100, 1103, 1108, 1110,
+   1113, 1116, 1120, 1124, 1127, 1129, 1135, 1138, 1141, 1144,
+   1147, 1150, 1154, 1158, 1161, 1166, 1171, 1173, 1175, 1176,
+   1177, 1178, 1179, 1180, 1186, 1194, 1197, 1200, 1209, 1213,
+   1218, 1221, 1229, 1240, 1249, 1256, 1261, 1270, 1275, 1278,
+   1281, 1285, 1291, 1297, 1300, 1303, 1306, 1314, 1318, 1319,
+   1320, 1325, 1328, 1333, 1334, 1334,
+};
+
+static const uint16_t font_5x7_runs[1334] = {
+    0x0131, 0x1051, 0x2011, 0x2211, 0x2411, 0x3051, 0x4021, 0x4321, 0x5011, 0x5411, 0x6131,   // 1
+    0x0131, 0x1051, 0x2011, 0x2211, 0x2411, 0x3051, 0x4011, 0x4411, 0x5021, 0x5321, 0x6131,   // 2
+    0x1111, 0x1311, 0x2053, 0x5131, 0x6211,   // 3
+    0x1211, 0x2131, 0x3052, 0x5131, 0x6211,   // 4
+    0x0131, 0x1111, 0x1311, 0x2051, 0x3011, 0x3211, 0x3411, 0x4051, 0x5211, 0x6131,   // 5
+    0x0211, 0x1131, 0x2053, 0x5211, 0x6131,   // 6
+    0x2211, 0x3132, 0x5211,   // 7
+    0x0052, 0x2021, 0x2321, 0x3012, 0x3412, 0x5021, 0x5321, 0x6052,   // 8
+    0x2211, 0x3112, 0x3312, 0x5211,   // 9
+    0x0052, 0x2021, 0x2321, 0x3012, 0x3212, 0x3412, 0x5021, 0x5321, 0x6052,   // 10
+    0x1231, 0x2321, 0x3121, 0x3411, 0x4012, 0x4212, 0x6111,   // 11
+    0x0131, 0x1012, 0x1412, 0x3131, 0x4211, 0x5051, 0x6211,   // 12
+    0x0141, 0x1111, 0x1411, 0x2141, 0x3113, 0x6021,   // 13
+    0x0141, 0x1111, 0x1411, 0x2141, 0x3113, 0x3412, 0x5321, 0x6021,   // 14
+    0x0212, 0x1011, 0x1411, 0x2131, 0x3022, 0x3322, 0x5131, 0x6011, 0x6212, 0x6411,   // 15
+    0x0011, 0x1021, 0x2041, 0x3051, 0x4041, 0x5021, 0x6011,   // 16
+    0x0411, 0x1321, 0x2141, 0x3051, 0x4141, 0x5321, 0x6411,   // 17
+    0x0211, 0x1131, 0x2011, 0x2213, 0x2411, 0x4011, 0x4411, 0x5131, 0x6211,   // 18
+    0x0025, 0x0325, 0x6021, 0x6321,   // 19
+    0x0141, 0x1012, 0x1212, 0x1416, 0x3121, 0x4213,   // 20
+    0x0221, 0x1112, 0x1411, 0x2311, 0x3211, 0x3411, 0x4311, 0x5112, 0x5412, 0x7221,   // 21
+    0x5052,   // 22
+    0x0211, 0x1131, 0x2011, 0x2213, 0x2411, 0x4011, 0x4411, 0x5131, 0x6211, 0x7051,   // 23
+    0x1211, 0x2131, 0x3011, 0x3214, 0x3411,   // 24
+    0x1214, 0x4011, 0x4411, 0x5131, 0x6211,   // 25
+    0x1211, 0x2311, 0x3051, 0x4311, 0x5211,   // 26
+    0x1211, 0x2111, 0x3051, 0x4111, 0x5211,   // 27
+    0x1013, 0x4051,   // 28
+    0x1111, 0x1311, 0x2052, 0x4111, 0x4311,   // 29
+    0x1212, 0x3131, 0x4052,   // 30
+    0x1052, 0x3131, 0x4212,   // 31
+    0x0215, 0x6211,   // 33
+    0x0113, 0x0313,   // 34
+    0x0112, 0x0312, 0x2051, 0x3111, 0x3311, 0x4051, 0x5112, 0x5312,   // 35
+    0x0211, 0x1141, 0x2011, 0x2211, 0x3131, 0x4211, 0x4411, 0x5041, 0x6211,   // 36
+    0x0022, 0x1411, 0x2311, 0x3211, 0x4111, 0x5011, 0x5322,   // 37
+    0x0111, 0x1012, 0x1212, 0x3111, 0x4012, 0x4211, 0x4411, 0x5311, 0x6121, 0x6411,   // 38
+    0x0222, 0x2211, 0x3111,   // 39
+    0x0311, 0x1211, 0x2113, 0x5211, 0x6311,   // 40
+    0x0111, 0x1211, 0x2313, 0x5211, 0x6111,   // 41
+    0x0212, 0x1011, 0x1411, 0x2131, 0x3051, 0x4131, 0x5011, 0x5212, 0x5411,   // 42
+    0x1212, 0x3051, 0x4212,   // 43
+    0x4222, 0x6211, 0x7111,   // 44
+    0x3051,   // 45
+    0x5222,   // 46
+    0x1411, 0x2311, 0x3211, 0x4111, 0x5011,   // 47
+    0x0131, 0x1013, 0x1411, 0x2321, 0x3211, 0x3413, 0x4021, 0x5011, 0x6131,   // 48
+    0x0211, 0x1121, 0x2214, 0x6131,   // 49
+    0x0131, 0x1011, 0x1412, 0x3131, 0x4012, 0x6051,   // 50
+    0x0051, 0x1411, 0x2311, 0x3221, 0x4412, 0x5011, 0x6131,   // 51
+    0x0311, 0x1221, 0x2111, 0x2312, 0x3011, 0x4051, 0x5312,   // 52
+    0x0051, 0x1011, 0x2041, 0x3413, 0x5011, 0x6131,   // 53
+    0x0231, 0x1111, 0x2011, 0x3041, 0x4012, 0x4412, 0x6131,   // 54
+    0x0051, 0x1412, 0x3311, 0x4211, 0x5111, 0x6011,   // 55
+    0x0131, 0x1012, 0x1412, 0x3131, 0x4012, 0x4412, 0x6131,   // 56
+    0x0131, 0x1012, 0x1412, 0x3141, 0x4411, 0x5311, 0x6031,   // 57
+    0x2211, 0x4211,   // 58
+    0x2211, 0x4212, 0x6111,   // 59
+    0x0411, 0x1311, 0x2211, 0x3111, 0x4211, 0x5311, 0x6411,   // 60
+    0x2051, 0x4051,   // 61
+    0x0111, 0x1211, 0x2311, 0x3411, 0x4311, 0x5211, 0x6111,   // 62
+    0x0131, 0x1011, 0x1412, 0x3221, 0x4211, 0x6211,   // 63
+    0x0131, 0x1015, 0x1412, 0x2211, 0x3231, 0x4221, 0x6141,   // 64
+    0x0211, 0x1111, 0x1311, 0x2012, 0x2412, 0x4051, 0x5012, 0x5412,   // 65
+    0x0041, 0x1012, 0x1412, 0x3041, 0x4012, 0x4412, 0x6041,   // 66
+    0x0131, 0x1015, 0x1411, 0x5411, 0x6131,   // 67
+    0x0041, 0x1015, 0x1415, 0x6041,   // 68
+    0x0051, 0x1012, 0x3041, 0x4012, 0x6051,   // 69
+    0x0051, 0x1012, 0x3041, 0x4013,   // 70
+    0x0141, 0x1015, 0x1411, 0x4321, 0x5411, 0x6141,   // 71
+    0x0013, 0x0413, 0x3051, 0x4013, 0x4413,   // 72
+    0x0131, 0x1215, 0x6131,   // 73
+    0x0231, 0x1315, 0x5011, 0x6121,   // 74
+    0x0013, 0x0411, 0x1311, 0x2211, 0x3021, 0x4013, 0x4211, 0x5311, 0x6411,   // 75
+    0x0016, 0x6051,   // 76
+    0x0011, 0x0411, 0x1021, 0x1321, 0x2015, 0x2213, 0x2415,   // 77
+    0x0012, 0x0414, 0x2021, 0x3014, 0x3211, 0x4321, 0x5412,   // 78
+    0x0131, 0x1015, 0x1415, 0x6131,   // 79
+    0x0041, 0x1012, 0x1412, 0x3041, 0x4013,   // 80
+    0x0131, 0x1015, 0x1414, 0x4211, 0x5311, 0x6121, 0x6411,   // 81
+    0x0041, 0x1012, 0x1412, 0x3041, 0x4013, 0x4211, 0x5311, 0x6411,   // 82
+    0x0131, 0x1012, 0x1411, 0x3131, 0x4412, 0x5011, 0x6131,   // 83
+    0x0051, 0x1011, 0x1216, 0x1411,   // 84
+    0x0016, 0x0416, 0x6131,   // 85
+    0x0015, 0x0415, 0x5111, 0x5311, 0x6211,   // 86
+    0x0016, 0x0416, 0x3213, 0x6111, 0x6311,   // 87
+    0x0012, 0x0412, 0x2111, 0x2311, 0x3211, 0x4111, 0x4311, 0x5012, 0x5412,   // 88
+    0x0012, 0x0412, 0x2111, 0x2311, 0x3214,   // 89
+    0x0051, 0x1411, 0x2311, 0x3131, 0x4111, 0x5011, 0x6051,   // 90
+    0x0141, 0x1115, 0x6141,   // 91
+    0x1011, 0x2111, 0x3211, 0x4311, 0x5411,   // 92
+    0x0141, 0x1415, 0x6141,   // 93
+    0x0211, 0x1111, 0x1311, 0x2011, 0x2411,   // 94
+    0x6051,   // 95
+    0x0122, 0x2211, 0x3311,   // 96
+    0x2121, 0x3311, 0x4131, 0x5011, 0x5311, 0x6141,   // 97
+    0x0013, 0x2221, 0x3021, 0x3413, 0x4011, 0x5021, 0x6011, 0x6221,   // 98
+    0x2131, 0x3013, 0x3411, 0x5411, 0x6131,   // 99
+    0x0413, 0x2121, 0x3013, 0x3321, 0x4411, 0x5321, 0x6121, 0x6411,   // 100
+    0x2131, 0x3011, 0x3411, 0x4051, 0x5011, 0x6131,   // 101
+    0x0311, 0x1212, 0x1411, 0x3131, 0x4213,   // 102
+    0x2131, 0x3012, 0x3322, 0x5121, 0x5412, 0x7131,   // 103
+    0x0013, 0x2221, 0x3021, 0x3414, 0x4013,   // 104
+    0x0211, 0x2121, 0x3213, 0x6131,   // 105
+    0x0311, 0x2314, 0x5011, 0x6121,   // 106
+    0x0014, 0x2311, 0x3211, 0x4021, 0x5012, 0x5211, 0x6311,   // 107
+    0x0121, 0x1215, 0x6131,   // 108
+    0x2021, 0x2311, 0x3014, 0x3214, 0x3414,   // 109
+    0x2011, 0x2221, 0x3021, 0x3414, 0x4013,   // 110
+    0x2131, 0x3013, 0x3413, 0x6131,   // 111
+    0x2011, 0x2221, 0x3022, 0x3412, 0x5013, 0x5221,   // 112
+    0x2121, 0x2411, 0x3012, 0x3322, 0x5121, 0x5413,   // 113
+    0x2011, 0x2221, 0x3021, 0x3411, 0x4013,   // 114
+    0x2141, 0x3011, 0x4131, 0x5411, 0x6041,   // 115
+    0x0212, 0x2051, 0x3213, 0x5411, 0x6311,   // 116
+    0x2014, 0x2413, 0x5321, 0x6121, 0x6411,   // 117
+    0x2013, 0x2413, 0x5111, 0x5311, 0x6211,   // 118
+    0x2014, 0x2414, 0x4212, 0x6111, 0x6311,   // 119
+    0x2011, 0x2411, 0x3111, 0x3311, 0x4211, 0x5111, 0x5311, 0x6011, 0x6411,   // 120
+    0x2012, 0x2412, 0x4141, 0x5412, 0x6011, 0x7131,   // 121
+    0x2051, 0x3311, 0x4211, 0x5111, 0x6051,   // 122
+    0x0311, 0x1212, 0x3111, 0x4212, 0x6311,   // 123
+    0x0213, 0x4213,   // 124
+    0x0111, 0x1212, 0x3311, 0x4212, 0x6111,   // 125
+    0x0111, 0x1011, 0x1211, 0x1411, 0x2311,   // 126
+    0x0211, 0x1131, 0x2021, 0x2321, 0x3012, 0x3412, 0x5051,   // 127
+    0x0131, 0x1014, 0x1411, 0x4411, 0x5131, 0x6311, 0x7121,   // 128
+    0x1011, 0x1411, 0x3013, 0x3412, 0x5321, 0x6121, 0x6411,   // 129
+    0x0321, 0x2131, 0x3011, 0x3411, 0x4051, 0x5011, 0x6141,   // 130
+    0x0051, 0x2121, 0x3311, 0x4131, 0x5011, 0x5311, 0x6141,   // 131
+    0x0011, 0x0411, 0x2121, 0x3311, 0x4131, 0x5011, 0x5311, 0x6141,   // 132
+    0x0021, 0x2121, 0x3311, 0x4131, 0x5011, 0x5311, 0x6141,   // 133
+    0x0221, 0x2121, 0x3311, 0x4131, 0x5011, 0x5311, 0x6141,   // 134
+    0x1141, 0x2022, 0x4141, 0x5311, 0x6221,   // 135
+    0x0051, 0x2131, 0x3011, 0x3411, 0x4051, 0x5011, 0x6141,   // 136
+    0x0011, 0x0411, 0x2131, 0x3011, 0x3411, 0x4051, 0x5011, 0x6141,   // 137
+    0x0021, 0x2131, 0x3011, 0x3411, 0x4051, 0x5011, 0x6141,   // 138
+    0x0211, 0x0411, 0x2221, 0x3313, 0x6231,   // 139
+    0x0221, 0x1111, 0x1411, 0x2221, 0x3313, 0x6231,   // 140
+    0x0121, 0x2221, 0x3313, 0x6231,   // 141
+    0x0111, 0x0311, 0x2211, 0x3111, 0x3311, 0x4011, 0x4411, 0x5051, 0x6012, 0x6412,   // 142
+    0x0211, 0x2211, 0x3111, 0x3311, 0x4011, 0x4411, 0x5051, 0x6012, 0x6412,   // 143
+    0x0221, 0x2041, 0x3011, 0x4031, 0x5011, 0x6041,   // 144
+    0x2141, 0x3311, 0x4141, 0x5011, 0x5311, 0x6141,   // 145
+    0x0231, 0x1111, 0x1312, 0x2011, 0x3051, 0x4013, 0x4312, 0x6321,   // 146
+    0x0131, 0x1011, 0x1411, 0x3131, 0x4012, 0x4412, 0x6131,   // 147
+    0x1011, 0x1411, 0x3131, 0x4012, 0x4412, 0x6131,   // 148
+    0x1021, 0x3131, 0x4012, 0x4412, 0x6131,   // 149
+    0x0131, 0x1011, 0x1411, 0x3013, 0x3412, 0x5321, 0x6121, 0x6411,   // 150
+    0x1021, 0x3013, 0x3412, 0x5321, 0x6121, 0x6411,   // 151
+    0x0111, 0x0411, 0x2113, 0x2413, 0x5231, 0x6411, 0x7131,   // 152
+    0x0011, 0x0411, 0x2131, 0x3013, 0x3413, 0x6131,   // 153
+    0x0011, 0x0411, 0x2014, 0x2414, 0x6131,   // 154
+    0x0212, 0x2051, 0x3012, 0x3212, 0x5051, 0x6212,   // 155
+    0x0221, 0x1112, 0x1321, 0x2411, 0x3031, 0x4112, 0x5411, 0x6051,   // 156
+    0x0022, 0x0322, 0x2131, 0x3051, 0x4211, 0x5051, 0x6212,   // 157
+    0x0031, 0x1012, 0x1312, 0x3031, 0x4014, 0x4311, 0x5231, 0x6312,   // 158
+    0x0321, 0x1212, 0x1411, 0x3131, 0x4213, 0x6011, 0x7021,   // 159
+    0x0321, 0x2121, 0x3311, 0x4131, 0x5011, 0x5311, 0x6141,   // 160
+    0x0321, 0x2221, 0x3313, 0x6231,   // 161
+    0x1321, 0x3131, 0x4012, 0x4412, 0x6131,   // 162
+    0x1321, 0x3013, 0x3412, 0x5321, 0x6121, 0x6411,   // 163
+    0x1141, 0x3131, 0x4113, 0x4413,   // 164
+    0x0051, 0x2021, 0x2412, 0x3031, 0x4013, 0x4231, 0x5321, 0x6411,   // 165
+    0x0131, 0x1012, 0x1312, 0x3141, 0x5051,   // 166
+    0x0131, 0x1012, 0x1412, 0x3131, 0x5051,   // 167
+    0x0211, 0x2211, 0x3121, 0x4012, 0x5411, 0x6131,   // 168
+    0x3051, 0x4012,   // 169
+    0x3051, 0x4412,   // 170
+    0x0014, 0x1411, 0x2311, 0x3231, 0x4111, 0x4411, 0x5011, 0x5321, 0x6211, 0x7231,   // 171
+    0x0014, 0x1411, 0x2311, 0x3211, 0x3411, 0x4111, 0x4321, 0x5011, 0x5231, 0x6412,   // 172
+    0x0212, 0x3214,   // 173
+    0x1211, 0x1411, 0x2111, 0x2311, 0x3011, 0x3211, 0x4111, 0x4311, 0x5211, 0x5411,   // 174
+    0x1011, 0x1211, 0x2111, 0x2311, 0x3211, 0x3411, 0x4111, 0x4311, 0x5011, 0x5211,   // 175
+    0x0211, 0x1011, 0x1411, 0x2211, 0x3011, 0x3411, 0x4211, 0x5011, 0x5411, 0x6211, 0x7011, 0x7411,   // 176
+    0x0111, 0x0311, 0x1011, 0x1211, 0x1411, 0x2111, 0x2311, 0x3011, 0x3211, 0x3411, 0x4111, 0x4311, 0x5011, 0x5211, 0x5411, 0x6111, 0x6311, 0x7011, 0x7211, 0x7411,   // 177
+    0x0318,   // 178
+    0x0314, 0x4041, 0x5313,   // 179
+    0x0312, 0x2041, 0x3311, 0x4041, 0x5313,   // 180
+    0x0214, 0x0418, 0x4031, 0x5213,   // 181
+    0x4051, 0x5213, 0x5413,   // 182
+    0x2041, 0x3311, 0x4041, 0x5313,   // 183
+    0x0212, 0x0418, 0x2031, 0x4031, 0x5213,   // 184
+    0x0218, 0x0418,   // 185
+    0x2051, 0x3415, 0x4031, 0x5213,   // 186
+    0x0212, 0x0414, 0x2031, 0x4051,   // 187
+    0x0214, 0x0414, 0x4051,   // 188
+    0x0312, 0x2041, 0x3311, 0x4041,   // 189
+    0x4041, 0x5313,   // 190
+    0x0314, 0x4321,   // 191
+    0x0314, 0x4051,   // 192
+    0x4051, 0x5313,   // 193
+    0x0314, 0x4321, 0x5313,   // 194
+    0x4051,   // 195
+    0x0314, 0x4051, 0x5313,   // 196
+    0x0312, 0x2321, 0x3311, 0x4321, 0x5313,   // 197
+    0x0218, 0x0418,   // 198
+    0x0214, 0x0413, 0x4231,   // 199
+    0x2231, 0x3215, 0x4414,   // 200
+    0x0212, 0x0413, 0x2031, 0x4051,   // 201
+    0x2051, 0x4031, 0x4414, 0x5213,   // 202
+    0x0218, 0x0413, 0x4414,   // 203
+    0x2051, 0x4051,   // 204
+    0x0212, 0x0413, 0x2031, 0x4031, 0x4414, 0x5213,   // 205
+    0x0312, 0x2051, 0x4051,   // 206
+    0x0214, 0x0414, 0x4051,   // 207
+    0x2051, 0x4051, 0x5313,   // 208
+    0x4051, 0x5213, 0x5413,   // 209
+    0x0214, 0x0414, 0x4231,   // 210
+    0x0312, 0x2321, 0x3311, 0x4321,   // 211
+    0x2321, 0x3311, 0x4321, 0x5313,   // 212
+    0x4231, 0x5213, 0x5413,   // 213
+    0x0214, 0x0414, 0x4051, 0x5213, 0x5413,   // 214
+    0x0312, 0x2051, 0x3311, 0x4051, 0x5313,   // 215
+    0x0314, 0x4041,   // 216
+    0x4321, 0x5313,   // 217
+    0x0058,   // 218
+    0x4054,   // 219
+    0x0038,   // 220
+    0x0328,   // 221
+    0x0054,   // 222
+    0x2121, 0x2411, 0x3013, 0x3313, 0x6121, 0x6411,   // 223
+    0x1131, 0x2011, 0x2321, 0x3041, 0x4011, 0x4321, 0x5041, 0x6011,   // 224
+    0x1051, 0x2015, 0x2321,   // 225
+    0x1051, 0x2115, 0x2315,   // 226
+    0x0051, 0x1011, 0x1411, 0x2111, 0x3211, 0x4111, 0x5011, 0x5411, 0x6051,   // 227
+    0x2141, 0x3013, 0x3313, 0x6121,   // 228
+    0x1114, 0x1314, 0x5121, 0x5411, 0x6021,   // 229
+    0x1051, 0x2011, 0x2215,   // 230
+    0x0051, 0x1211, 0x2131, 0x3012, 0x3412, 0x5131, 0x6211, 0x7051,   // 231
+    0x0211, 0x1111, 0x1311, 0x2011, 0x2411, 0x3051, 0x4011, 0x4411, 0x5111, 0x5311, 0x6211,   // 232
+    0x0211, 0x1111, 0x1311, 0x2012, 0x2412, 0x4112, 0x4312, 0x6021, 0x6321,   // 233
+    0x0221, 0x1111, 0x2221, 0x3131, 0x4012, 0x4412, 0x6131,   // 234
+    0x3131, 0x4012, 0x4212, 0x4412, 0x6131,   // 235
+    0x0411, 0x1131, 0x2013, 0x2321, 0x3212, 0x3413, 0x5021, 0x6131, 0x7011,   // 236
+    0x0131, 0x1012, 0x3041, 0x4012, 0x6131,   // 237
+    0x0131, 0x1016, 0x1416,   // 238
+    0x1051, 0x3051, 0x5051,   // 239
+    0x0212, 0x2051, 0x3212, 0x6051,   // 240
+    0x0111, 0x1211, 0x2311, 0x3211, 0x4111, 0x6051,   // 241
+    0x0311, 0x1211, 0x2111, 0x3211, 0x4311, 0x6051,   // 242
+    0x0231, 0x1217, 0x1411,   // 243
+    0x0217, 0x5012, 0x7031,   // 244
+    0x0222, 0x3051, 0x5222,   // 245
+    0x1031, 0x1411, 0x2011, 0x2231, 0x4031, 0x4411, 0x5011, 0x5231,   // 246
+    0x0131, 0x1022, 0x1322, 0x3131,   // 247
+    0x3222,   // 248
+    0x4221,   // 249
+    0x0231, 0x1215, 0x4012, 0x6121, 0x7211,   // 250
+    0x0131, 0x1114, 0x1414,   // 251
+    0x0131, 0x1321, 0x2221, 0x3121, 0x4141,   // 252
+    0x2144,   // 253
+};
+
+static const uint16_t font_5x7_aa[2040] = {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 0
+    0x6e40, 0xbf80, 0xccc0, 0xffc0, 0xe2c0, 0xc0c0, 0x7f40, 0x0000,   // 1
+    0x6e40, 0xbf80, 0xccc0, 0xffc0, 0xc0c0, 0xa280, 0x6e40, 0x0000,   // 2
+    0x0000, 0x7340, 0xbf80, 0xffc0, 0xbf80, 0x6e40, 0x1d00, 0x0000,   // 3
+    0x0000, 0x1d00, 0x6e40, 0xbf80, 0xbf80, 0x6e40, 0x1d00, 0x0000,   // 4
+    0x2e00, 0x7340, 0xbf80, 0xccc0, 0xbf80, 0x0c00, 0x3f00, 0x0000,   // 5
+    0x1d00, 0x6e40, 0xbf80, 0xffc0, 0xbf80, 0x0c00, 0x3f00, 0x0000,   // 6
+    0x0000, 0x0000, 0x1d00, 0x2e00, 0x2e00, 0x1d00, 0x0000, 0x0000,   // 7
+    0xbf80, 0xffc0, 0xe2c0, 0xd1c0, 0xd1c0, 0xe2c0, 0xffc0, 0xbf80,   // 8
+    0x0000, 0x0000, 0x1d00, 0x3300, 0x3300, 0x1d00, 0x0000, 0x0000,   // 9
+    0xbf80, 0xffc0, 0xe2c0, 0xccc0, 0xccc0, 0xe2c0, 0xffc0, 0xbf80,   // 10
+    0x0000, 0x0f80, 0x02c0, 0x78c0, 0xcc00, 0xcc00, 0x7400, 0x0000,   // 11
+    0x7f40, 0xd1c0, 0xd1c0, 0x7f40, 0x0c00, 0xffc0, 0x1d00, 0x0000,   // 12
+    0x2f80, 0x30c0, 0x3f80, 0x3400, 0x3000, 0x7000, 0xe000, 0x0000,   // 13
+    0x2f80, 0x30c0, 0x3fc0, 0x35c0, 0x31c0, 0x7380, 0xe000, 0x0000,   // 14
+    0x0c00, 0xccc0, 0x2e00, 0xb380, 0xb380, 0x2e00, 0xccc0, 0x0c00,   // 15
+    0xd000, 0xe400, 0xfe40, 0xffc0, 0xfe40, 0xe400, 0xd000, 0x0000,   // 16
+    0x01c0, 0x06c0, 0x6fc0, 0xffc0, 0x6fc0, 0x06c0, 0x01c0, 0x0000,   // 17
+    0x1d00, 0x7f40, 0xccc0, 0x0c00, 0xccc0, 0x7f40, 0x1d00, 0x0000,   // 18
+    0xa280, 0xf3c0, 0xf3c0, 0xf3c0, 0xa280, 0x0000, 0xf3c0, 0x0000,   // 19
+    0x7f80, 0xccc0, 0xccc0, 0x7cc0, 0x1cc0, 0x0cc0, 0x0cc0, 0x0000,   // 20
+    0x1f40, 0x34c0, 0x3300, 0x1cc0, 0x0700, 0x31c0, 0x35c0, 0x1f40,   // 21
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xbf80, 0xbf80, 0x0000,   // 22
+    0x1d00, 0x7f40, 0xccc0, 0x0c00, 0xccc0, 0x7f40, 0x0c00, 0xffc0,   // 23
+    0x0000, 0x1d00, 0x7f40, 0xccc0, 0x0c00, 0x0c00, 0x0c00, 0x0000,   // 24
+    0x0000, 0x0c00, 0x0c00, 0x0c00, 0xccc0, 0x7f40, 0x1d00, 0x0000,   // 25
+    0x0000, 0x0d00, 0x0340, 0xffc0, 0x0340, 0x0d00, 0x0000, 0x0000,   // 26
+    0x0000, 0x1c00, 0x7000, 0xffc0, 0x7000, 0x1c00, 0x0000, 0x0000,   // 27
+    0x0000, 0xc000, 0xc000, 0xd000, 0xbfc0, 0x0000, 0x0000, 0x0000,   // 28
+    0x0000, 0x7340, 0xbf80, 0xbf80, 0x7340, 0x0000, 0x0000, 0x0000,   // 29
+    0x0000, 0x0c00, 0x1d00, 0x6e40, 0xbf80, 0xbf80, 0x0000, 0x0000,   // 30
+    0x0000, 0xbf80, 0xbf80, 0x6e40, 0x1d00, 0x0c00, 0x0000, 0x0000,   // 31
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 32
+    0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0000, 0x0c00, 0x0000,   // 33
+    0x3300, 0x3300, 0x3300, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 34
+    0x3300, 0x7340, 0xffc0, 0x3300, 0xffc0, 0x7340, 0x3300, 0x0000,   // 35
+    0x1d00, 0x7fc0, 0xcc00, 0x7f40, 0x0cc0, 0xff40, 0x1d00, 0x0000,   // 36
+    0xa000, 0xa1c0, 0x0740, 0x1d00, 0x7400, 0xd280, 0x0280, 0x0000,   // 37
+    0x7400, 0xcc00, 0xcc00, 0x3000, 0xccc0, 0xd300, 0x7cc0, 0x0000,   // 38
+    0x0a00, 0x0e00, 0x1d00, 0x3400, 0x0000, 0x0000, 0x0000, 0x0000,   // 39
+    0x0700, 0x1d00, 0x3400, 0x3000, 0x3400, 0x1d00, 0x0700, 0x0000,   // 40
+    0x3400, 0x1d00, 0x0700, 0x0300, 0x0700, 0x1d00, 0x3400, 0x0000,   // 41
+    0x0c00, 0xccc0, 0x2e00, 0xffc0, 0x2e00, 0xccc0, 0x0c00, 0x0000,   // 42
+    0x0000, 0x0c00, 0x1d00, 0xffc0, 0x1d00, 0x0c00, 0x0000, 0x0000,   // 43
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0a00, 0x0e00, 0x1d00, 0x3400,   // 44
+    0x0000, 0x0000, 0x0000, 0xffc0, 0x0000, 0x0000, 0x0000, 0x0000,   // 45
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0a00, 0x0a00, 0x0000,   // 46
+    0x0000, 0x01c0, 0x0740, 0x1d00, 0x7400, 0xd000, 0x0000, 0x0000,   // 47
+    0x7f40, 0xd0c0, 0xc7c0, 0xccc0, 0xf4c0, 0xc1c0, 0x7f40, 0x0000,   // 48
+    0x1c00, 0x3c00, 0x1c00, 0x0c00, 0x0c00, 0x1d00, 0x3f00, 0x0000,   // 49
+    0x7f40, 0xd1c0, 0x01c0, 0x7f40, 0xd000, 0xd000, 0xbfc0, 0x0000,   // 50
+    0xff80, 0x00c0, 0x0740, 0x0e40, 0x01c0, 0xd1c0, 0x7f40, 0x0000,   // 51
+    0x0700, 0x1f00, 0x7300, 0xc740, 0xbfc0, 0x0740, 0x0300, 0x0000,   // 52
+    0xbfc0, 0xc000, 0xbf40, 0x01c0, 0x00c0, 0xd1c0, 0x7f40, 0x0000,   // 53
+    0x1fc0, 0x7400, 0xc000, 0xff40, 0xd1c0, 0xd1c0, 0x7f40, 0x0000,   // 54
+    0xff80, 0x01c0, 0x01c0, 0x0740, 0x1d00, 0x7400, 0xd000, 0x0000,   // 55
+    0x7f40, 0xd1c0, 0xd1c0, 0x3f00, 0xd1c0, 0xd1c0, 0x7f40, 0x0000,   // 56
+    0x7f40, 0xd1c0, 0xd1c0, 0x7fc0, 0x00c0, 0x0740, 0xfd00, 0x0000,   // 57
+    0x0000, 0x0000, 0x0c00, 0x0000, 0x0c00, 0x0000, 0x0000, 0x0000,   // 58
+    0x0000, 0x0000, 0x0c00, 0x0000, 0x0c00, 0x1c00, 0x3400, 0x0000,   // 59
+    0x01c0, 0x0740, 0x1d00, 0x3000, 0x1d00, 0x0740, 0x01c0, 0x0000,   // 60
+    0x0000, 0x0000, 0xffc0, 0x0000, 0xffc0, 0x0000, 0x0000, 0x0000,   // 61
+    0x3400, 0x1d00, 0x0740, 0x00c0, 0x0740, 0x1d00, 0x3400, 0x0000,   // 62
+    0x7f40, 0xd1c0, 0x01c0, 0x0b40, 0x0d00, 0x0000, 0x0c00, 0x0000,   // 63
+    0x7f40, 0xd1c0, 0xccc0, 0xcf80, 0xca40, 0xd000, 0x7fc0, 0x0000,   // 64
+    0x1d00, 0x7340, 0xd1c0, 0xd1c0, 0xffc0, 0xd1c0, 0xc0c0, 0x0000,   // 65
+    0xbf40, 0xd1c0, 0xd1c0, 0xff00, 0xd1c0, 0xd1c0, 0xbf40, 0x0000,   // 66
+    0x7f40, 0xd1c0, 0xc000, 0xc000, 0xc000, 0xd1c0, 0x7f40, 0x0000,   // 67
+    0xbf40, 0xd1c0, 0xc0c0, 0xc0c0, 0xc0c0, 0xd1c0, 0xbf40, 0x0000,   // 68
+    0xbfc0, 0xd000, 0xd000, 0xff00, 0xd000, 0xd000, 0xbfc0, 0x0000,   // 69
+    0xbfc0, 0xd000, 0xd000, 0xff00, 0xd000, 0xc000, 0xc000, 0x0000,   // 70
+    0x7f80, 0xd1c0, 0xc000, 0xc000, 0xc380, 0xd0c0, 0x7f80, 0x0000,   // 71
+    0xc0c0, 0xc0c0, 0xd1c0, 0xffc0, 0xd1c0, 0xc0c0, 0xc0c0, 0x0000,   // 72
+    0x3f00, 0x1d00, 0x0c00, 0x0c00, 0x0c00, 0x1d00, 0x3f00, 0x0000,   // 73
+    0x0fc0, 0x0740, 0x0300, 0x0300, 0x0300, 0xd700, 0x7d00, 0x0000,   // 74
+    0xc1c0, 0xc740, 0xcd00, 0xf000, 0xcd00, 0xc740, 0xc1c0, 0x0000,   // 75
+    0xc000, 0xc000, 0xc000, 0xc000, 0xc000, 0xd000, 0xbfc0, 0x0000,   // 76
+    0xd1c0, 0xf3c0, 0xccc0, 0xccc0, 0xccc0, 0xc0c0, 0xc0c0, 0x0000,   // 77
+    0xc0c0, 0xd0c0, 0xf4c0, 0xccc0, 0xc7c0, 0xc1c0, 0xc0c0, 0x0000,   // 78
+    0x7f40, 0xd1c0, 0xc0c0, 0xc0c0, 0xc0c0, 0xd1c0, 0x7f40, 0x0000,   // 79
+    0xbf40, 0xd1c0, 0xd1c0, 0xff40, 0xd000, 0xc000, 0xc000, 0x0000,   // 80
+    0x7f40, 0xd1c0, 0xc0c0, 0xc0c0, 0xccc0, 0xd300, 0x7cc0, 0x0000,   // 81
+    0xbf40, 0xd1c0, 0xd1c0, 0xff40, 0xcc00, 0xc740, 0xc1c0, 0x0000,   // 82
+    0x7f40, 0xd1c0, 0xd000, 0x7f40, 0x01c0, 0xd1c0, 0x7f40, 0x0000,   // 83
+    0xbf80, 0xccc0, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0000,   // 84
+    0xc0c0, 0xc0c0, 0xc0c0, 0xc0c0, 0xc0c0, 0xd1c0, 0x7f40, 0x0000,   // 85
+    0xc0c0, 0xc0c0, 0xc0c0, 0xc0c0, 0xd1c0, 0x7340, 0x1d00, 0x0000,   // 86
+    0xc0c0, 0xc0c0, 0xc0c0, 0xccc0, 0xccc0, 0xccc0, 0x7340, 0x0000,   // 87
+    0xc0c0, 0xd1c0, 0x7340, 0x0c00, 0x7340, 0xd1c0, 0xc0c0, 0x0000,   // 88
+    0xc0c0, 0xd1c0, 0x7340, 0x1d00, 0x0c00, 0x0c00, 0x0c00, 0x0000,   // 89
+    0xff80, 0x00c0, 0x0740, 0x2e00, 0x7400, 0xc000, 0xbfc0, 0x0000,   // 90
+    0x2fc0, 0x3400, 0x3000, 0x3000, 0x3000, 0x3400, 0x2fc0, 0x0000,   // 91
+    0x0000, 0xd000, 0x7400, 0x1d00, 0x0740, 0x01c0, 0x0000, 0x0000,   // 92
+    0x3f80, 0x01c0, 0x00c0, 0x00c0, 0x00c0, 0x01c0, 0x3f80, 0x0000,   // 93
+    0x1d00, 0x7340, 0xd1c0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 94
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xffc0, 0x0000,   // 95
+    0x2800, 0x2c00, 0x1d00, 0x0700, 0x0000, 0x0000, 0x0000, 0x0000,   // 96
+    0x0000, 0x0000, 0x3d00, 0x0300, 0x7f00, 0xc340, 0x7fc0, 0x0000,   // 97
+    0xc000, 0xc000, 0xcf40, 0xf5c0, 0xc0c0, 0xf5c0, 0xcf40, 0x0000,   // 98
+    0x0000, 0x0000, 0x7f40, 0xd1c0, 0xc000, 0xd1c0, 0x7f40, 0x0000,   // 99
+    0x00c0, 0x00c0, 0x7cc0, 0xd7c0, 0xc0c0, 0xd7c0, 0x7cc0, 0x0000,   // 100
+    0x0000, 0x0000, 0x7f40, 0xc0c0, 0xff80, 0xc000, 0x7f00, 0x0000,   // 101
+    0x0740, 0x0cc0, 0x1d00, 0x3f00, 0x1d00, 0x0c00, 0x0c00, 0x0000,   // 102
+    0x0000, 0x0000, 0x7e40, 0xd780, 0xd6c0, 0x7cc0, 0x01c0, 0x3f40,   // 103
+    0xc000, 0xc000, 0xcf40, 0xf5c0, 0xd0c0, 0xc0c0, 0xc0c0, 0x0000,   // 104
+    0x0c00, 0x0000, 0x3800, 0x1c00, 0x0c00, 0x1d00, 0x3f00, 0x0000,   // 105
+    0x0300, 0x0000, 0x0300, 0x0300, 0x0300, 0xd700, 0x7d00, 0x0000,   // 106
+    0xc000, 0xc000, 0xc700, 0xcd00, 0xf000, 0xcd00, 0xc700, 0x0000,   // 107
+    0x3800, 0x1c00, 0x0c00, 0x0c00, 0x0c00, 0x1d00, 0x3f00, 0x0000,   // 108
+    0x0000, 0x0000, 0xb340, 0xccc0, 0xccc0, 0xccc0, 0xccc0, 0x0000,   // 109
+    0x0000, 0x0000, 0xcf40, 0xf5c0, 0xd0c0, 0xc0c0, 0xc0c0, 0x0000,   // 110
+    0x0000, 0x0000, 0x7f40, 0xd1c0, 0xc0c0, 0xd1c0, 0x7f40, 0x0000,   // 111
+    0x0000, 0x0000, 0xcf40, 0xe5c0, 0xe5c0, 0xcf40, 0xc000, 0xc000,   // 112
+    0x0000, 0x0000, 0x7cc0, 0xd6c0, 0xd6c0, 0x7cc0, 0x00c0, 0x00c0,   // 113
+    0x0000, 0x0000, 0xcf40, 0xf5c0, 0xd000, 0xc000, 0xc000, 0x0000,   // 114
+    0x0000, 0x0000, 0x7fc0, 0xc000, 0x7f40, 0x00c0, 0xff40, 0x0000,   // 115
+    0x0c00, 0x1d00, 0xffc0, 0x1d00, 0x0c00, 0x0cc0, 0x0740, 0x0000,   // 116
+    0x0000, 0x0000, 0xc0c0, 0xc0c0, 0xc1c0, 0xd7c0, 0x7cc0, 0x0000,   // 117
+    0x0000, 0x0000, 0xc0c0, 0xc0c0, 0xd1c0, 0x7340, 0x1d00, 0x0000,   // 118
+    0x0000, 0x0000, 0xc0c0, 0xc0c0, 0xccc0, 0xccc0, 0x7340, 0x0000,   // 119
+    0x0000, 0x0000, 0xd1c0, 0x7340, 0x0c00, 0x7340, 0xd1c0, 0x0000,   // 120
+    0x0000, 0x0000, 0xc0c0, 0xd1c0, 0x7fc0, 0x01c0, 0xd1c0, 0x7f40,   // 121
+    0x0000, 0x0000, 0xffc0, 0x0340, 0x1d00, 0x7000, 0xffc0, 0x0000,   // 122
+    0x0700, 0x0d00, 0x1c00, 0x3000, 0x1c00, 0x0d00, 0x0700, 0x0000,   // 123
+    0x0c00, 0x0c00, 0x0c00, 0x0000, 0x0c00, 0x0c00, 0x0c00, 0x0000,   // 124
+    0x3400, 0x1c00, 0x0d00, 0x0300, 0x0d00, 0x1c00, 0x3400, 0x0000,   // 125
+    0x7400, 0xccc0, 0x0740, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 126
+    0x1d00, 0x6e40, 0xa280, 0xd1c0, 0xd1c0, 0xbf80, 0x0000, 0x0000,   // 127
+    0x7f40, 0xd1c0, 0xc000, 0xc000, 0xd1c0, 0x7e40, 0x0300, 0x3d00,   // 128
+    0x0000, 0xc0c0, 0x0000, 0xc0c0, 0xc1c0, 0xd7c0, 0x7cc0, 0x0000,   // 129
+    0x03c0, 0x0000, 0x7f40, 0xc0c0, 0xff80, 0xc000, 0x7fc0, 0x0000,   // 130
+    0xffc0, 0x0000, 0x3d00, 0x0300, 0x7f00, 0xc340, 0x7fc0, 0x0000,   // 131
+    0xc0c0, 0x0000, 0x3d00, 0x0300, 0x7f00, 0xc340, 0x7fc0, 0x0000,   // 132
+    0xf000, 0x0000, 0x3d00, 0x0300, 0x7f00, 0xc340, 0x7fc0, 0x0000,   // 133
+    0x0f00, 0x0000, 0x3d00, 0x0300, 0x7f00, 0xc340, 0x7fc0, 0x0000,   // 134
+    0x0000, 0x6fc0, 0xb400, 0xb400, 0x6fc0, 0x0340, 0x0e00, 0x0000,   // 135
+    0xffc0, 0x0000, 0x7f40, 0xc0c0, 0xff80, 0xc000, 0x7fc0, 0x0000,   // 136
+    0xc0c0, 0x0000, 0x7f40, 0xc0c0, 0xff80, 0xc000, 0x7fc0, 0x0000,   // 137
+    0xf000, 0x0000, 0x7f40, 0xc0c0, 0xff80, 0xc000, 0x7fc0, 0x0000,   // 138
+    0x0cc0, 0x0000, 0x0e00, 0x0700, 0x0300, 0x0740, 0x0fc0, 0x0000,   // 139
+    0x1f40, 0x30c0, 0x1e40, 0x0700, 0x0300, 0x0740, 0x0fc0, 0x0000,   // 140
+    0x3c00, 0x0000, 0x0e00, 0x0700, 0x0300, 0x0740, 0x0fc0, 0x0000,   // 141
+    0x3300, 0x0000, 0x1d00, 0x7340, 0xc0c0, 0xffc0, 0xd1c0, 0xc0c0,   // 142
+    0x0c00, 0x0000, 0x1d00, 0x7340, 0xc0c0, 0xffc0, 0xd1c0, 0xc0c0,   // 143
+    0x0f00, 0x0000, 0xbf00, 0xc000, 0xfc00, 0xc000, 0xbf00, 0x0000,   // 144
+    0x0000, 0x0000, 0x3fc0, 0x0300, 0x7fc0, 0xc300, 0x7fc0, 0x0000,   // 145
+    0x1fc0, 0x7340, 0xc740, 0xffc0, 0xd740, 0xc340, 0xc2c0, 0x0000,   // 146
+    0x7f40, 0xd1c0, 0x0000, 0x7f40, 0xd1c0, 0xd1c0, 0x7f40, 0x0000,   // 147
+    0x0000, 0xc0c0, 0x0000, 0x7f40, 0xd1c0, 0xd1c0, 0x7f40, 0x0000,   // 148
+    0x0000, 0xf000, 0x0000, 0x7f40, 0xd1c0, 0xd1c0, 0x7f40, 0x0000,   // 149
+    0x7f40, 0xd1c0, 0x0000, 0xc0c0, 0xc1c0, 0xd7c0, 0x7cc0, 0x0000,   // 150
+    0x0000, 0xf000, 0x0000, 0xc0c0, 0xc1c0, 0xd7c0, 0x7cc0, 0x0000,   // 151
+    0x30c0, 0x0000, 0x30c0, 0x30c0, 0x35c0, 0x1fc0, 0x00c0, 0x3f40,   // 152
+    0xc0c0, 0x0000, 0x7f40, 0xd1c0, 0xc0c0, 0xd1c0, 0x7f40, 0x0000,   // 153
+    0xc0c0, 0x0000, 0xc0c0, 0xc0c0, 0xc0c0, 0xd1c0, 0x7f40, 0x0000,   // 154
+    0x0c00, 0x1d00, 0xbfc0, 0xcd00, 0xcd00, 0xbfc0, 0x1d00, 0x0c00,   // 155
+    0x1e40, 0x3280, 0x75c0, 0xfc00, 0x7400, 0x75c0, 0xff80, 0x0000,   // 156
+    0xa280, 0xb380, 0x3f00, 0xffc0, 0x0c00, 0xffc0, 0x1d00, 0x0c00,   // 157
+    0xbd00, 0xd700, 0xd700, 0xfc00, 0xd340, 0xcfc0, 0xc740, 0xc300,   // 158
+    0x0780, 0x0cc0, 0x1d00, 0x3f00, 0x1d00, 0x0c00, 0xcc00, 0xb400,   // 159
+    0x03c0, 0x0000, 0x3d00, 0x0300, 0x7f00, 0xc340, 0x7fc0, 0x0000,   // 160
+    0x03c0, 0x0000, 0x0e00, 0x0700, 0x0300, 0x0740, 0x0fc0, 0x0000,   // 161
+    0x0000, 0x03c0, 0x0000, 0x7f40, 0xd1c0, 0xd1c0, 0x7f40, 0x0000,   // 162
+    0x0000, 0x03c0, 0x0000, 0xc0c0, 0xc1c0, 0xd7c0, 0x7cc0, 0x0000,   // 163
+    0x0000, 0x3fc0, 0x0000, 0x2f40, 0x35c0, 0x30c0, 0x30c0, 0x0000,   // 164
+    0xffc0, 0x0000, 0xa4c0, 0xf8c0, 0xcbc0, 0xc6c0, 0xc1c0, 0x0000,   // 165
+    0x7e00, 0xd700, 0xd740, 0x7fc0, 0x0000, 0xffc0, 0x0000, 0x0000,   // 166
+    0x7f40, 0xd1c0, 0xd1c0, 0x7f40, 0x0000, 0xffc0, 0x0000, 0x0000,   // 167
+    0x0c00, 0x0000, 0x1c00, 0x7800, 0xd000, 0xd1c0, 0x7f40, 0x0000,   // 168
+    0x0000, 0x0000, 0x0000, 0xbfc0, 0xd000, 0xc000, 0x0000, 0x0000,   // 169
+    0x0000, 0x0000, 0x0000, 0xff80, 0x01c0, 0x00c0, 0x0000, 0x0000,   // 170
+    0xc000, 0xc1c0, 0xc700, 0xcf80, 0x34c0, 0xd780, 0x0c00, 0x0bc0,   // 171
+    0xc000, 0xc1c0, 0xc700, 0xccc0, 0x32c0, 0xcfc0, 0x01c0, 0x00c0,   // 172
+    0x0c00, 0x0c00, 0x0000, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0000,   // 173
+    0x0000, 0x1cc0, 0x7340, 0xcc00, 0x7340, 0x1cc0, 0x0000, 0x0000,   // 174
+    0x0000, 0xcd00, 0x7340, 0x0cc0, 0x7340, 0xcd00, 0x0000, 0x0000,   // 175
+    0x0c00, 0xc0c0, 0x0c00, 0xc0c0, 0x0c00, 0xc0c0, 0x0c00, 0xc0c0,   // 176
+    0x7340, 0xccc0, 0x3300, 0xccc0, 0x3300, 0xccc0, 0x3300, 0xccc0,   // 177
+    0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300, 0x0300,   // 178
+    0x0300, 0x0300, 0x0300, 0x0700, 0xff00, 0x0700, 0x0300, 0x0300,   // 179
+    0x0300, 0x0700, 0xff00, 0x0300, 0xff00, 0x0700, 0x0300, 0x0300,   // 180
+    0x0cc0, 0x0cc0, 0x0cc0, 0x1cc0, 0xfcc0, 0x1cc0, 0x0cc0, 0x0cc0,   // 181
+    0x0000, 0x0000, 0x0000, 0x0000, 0xff80, 0x1cc0, 0x0cc0, 0x0cc0,   // 182
+    0x0000, 0x0000, 0xfe00, 0x0300, 0xff00, 0x0700, 0x0300, 0x0300,   // 183
+    0x0cc0, 0x1cc0, 0xf8c0, 0x00c0, 0xf8c0, 0x1cc0, 0x0cc0, 0x0cc0,   // 184
+    0x0cc0, 0x0cc0, 0x0cc0, 0x0cc0, 0x0cc0, 0x0cc0, 0x0cc0, 0x0cc0,   // 185
+    0x0000, 0x0000, 0xff80, 0x01c0, 0xf8c0, 0x1cc0, 0x0cc0, 0x0cc0,   // 186
+    0x0cc0, 0x1cc0, 0xf8c0, 0x01c0, 0xff80, 0x0000, 0x0000, 0x0000,   // 187
+    0x0cc0, 0x0cc0, 0x0cc0, 0x1cc0, 0xff80, 0x0000, 0x0000, 0x0000,   // 188
+    0x0300, 0x0700, 0xff00, 0x0300, 0xfe00, 0x0000, 0x0000, 0x0000,   // 189
+    0x0000, 0x0000, 0x0000, 0x0000, 0xfe00, 0x0700, 0x0300, 0x0300,   // 190
+    0x0300, 0x0300, 0x0300, 0x0340, 0x02c0, 0x0000, 0x0000, 0x0000,   // 191
+    0x0300, 0x0300, 0x0300, 0x0740, 0xffc0, 0x0000, 0x0000, 0x0000,   // 192
+    0x0000, 0x0000, 0x0000, 0x0000, 0xffc0, 0x0740, 0x0300, 0x0300,   // 193
+    0x0300, 0x0300, 0x0300, 0x0340, 0x03c0, 0x0340, 0x0300, 0x0300,   // 194
+    0x0000, 0x0000, 0x0000, 0x0000, 0xffc0, 0x0000, 0x0000, 0x0000,   // 195
+    0x0300, 0x0300, 0x0300, 0x0740, 0xffc0, 0x0740, 0x0300, 0x0300,   // 196
+    0x0300, 0x0340, 0x03c0, 0x0300, 0x03c0, 0x0340, 0x0300, 0x0300,   // 197
+    0x0cc0, 0x0cc0, 0x0cc0, 0x0cc0, 0x0cc0, 0x0cc0, 0x0cc0, 0x0cc0,   // 198
+    0x0cc0, 0x0cc0, 0x0cc0, 0x0d00, 0x0bc0, 0x0000, 0x0000, 0x0000,   // 199
+    0x0000, 0x0000, 0x0bc0, 0x0d00, 0x0cc0, 0x0cc0, 0x0cc0, 0x0cc0,   // 200
+    0x0cc0, 0x1cc0, 0xf8c0, 0x0000, 0xffc0, 0x0000, 0x0000, 0x0000,   // 201
+    0x0000, 0x0000, 0xffc0, 0x0000, 0xf8c0, 0x1cc0, 0x0cc0, 0x0cc0,   // 202
+    0x0cc0, 0x0cc0, 0x0cc0, 0x0c00, 0x0cc0, 0x0cc0, 0x0cc0, 0x0cc0,   // 203
+    0x0000, 0x0000, 0xffc0, 0x0000, 0xffc0, 0x0000, 0x0000, 0x0000,   // 204
+    0x0cc0, 0x1cc0, 0xf8c0, 0x0000, 0xf8c0, 0x1cc0, 0x0cc0, 0x0cc0,   // 205
+    0x0300, 0x0740, 0xffc0, 0x0000, 0xffc0, 0x0000, 0x0000, 0x0000,   // 206
+    0x0cc0, 0x0cc0, 0x0cc0, 0x1cc0, 0xff80, 0x0000, 0x0000, 0x0000,   // 207
+    0x0000, 0x0000, 0xffc0, 0x0000, 0xffc0, 0x0740, 0x0300, 0x0300,   // 208
+    0x0000, 0x0000, 0x0000, 0x0000, 0xff80, 0x1cc0, 0x0cc0, 0x0cc0,   // 209
+    0x0cc0, 0x0cc0, 0x0cc0, 0x0cc0, 0x0b80, 0x0000, 0x0000, 0x0000,   // 210
+    0x0300, 0x0340, 0x03c0, 0x0300, 0x02c0, 0x0000, 0x0000, 0x0000,   // 211
+    0x0000, 0x0000, 0x02c0, 0x0300, 0x03c0, 0x0340, 0x0300, 0x0300,   // 212
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0b80, 0x0cc0, 0x0cc0, 0x0cc0,   // 213
+    0x0cc0, 0x0cc0, 0x0cc0, 0x1cc0, 0xffc0, 0x1cc0, 0x0cc0, 0x0cc0,   // 214
+    0x0300, 0x0740, 0xffc0, 0x0300, 0xffc0, 0x0740, 0x0300, 0x0300,   // 215
+    0x0300, 0x0300, 0x0300, 0x0700, 0xfe00, 0x0000, 0x0000, 0x0000,   // 216
+    0x0000, 0x0000, 0x0000, 0x0000, 0x02c0, 0x0340, 0x0300, 0x0300,   // 217
+    0xbf80, 0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xffc0, 0xbf80,   // 218
+    0x0000, 0x0000, 0x0000, 0x0000, 0xbf80, 0xffc0, 0xffc0, 0xbf80,   // 219
+    0xb800, 0xfc00, 0xfc00, 0xfc00, 0xfc00, 0xfc00, 0xfc00, 0xb800,   // 220
+    0x0280, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x03c0, 0x0280,   // 221
+    0xbf80, 0xffc0, 0xffc0, 0xbf80, 0x0000, 0x0000, 0x0000, 0x0000,   // 222
+    0x0000, 0x0000, 0x7cc0, 0xd740, 0xc300, 0xd740, 0x7cc0, 0x0000,   // 223
+    0x0000, 0x7e40, 0xc3c0, 0xff00, 0xc3c0, 0xfe40, 0xd000, 0x0000,   // 224
+    0x0000, 0xbf80, 0xd680, 0xc000, 0xc000, 0xc000, 0xc000, 0x0000,   // 225
+    0x0000, 0xffc0, 0x7340, 0x3300, 0x3300, 0x3300, 0x3300, 0x0000,   // 226
+    0xbf80, 0xc1c0, 0x7400, 0x0c00, 0x7400, 0xc1c0, 0xbf80, 0x0000,   // 227
+    0x0000, 0x0000, 0x7fc0, 0xd740, 0xc300, 0xd700, 0x7d00, 0x0000,   // 228
+    0x0000, 0x3300, 0x3300, 0x3300, 0x3340, 0x7cc0, 0xe400, 0x0000,   // 229
+    0x0000, 0xbfc0, 0xcd00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0000,   // 230
+    0xffc0, 0x0c00, 0x7f40, 0xd1c0, 0xd1c0, 0x7f40, 0x0c00, 0xffc0,   // 231
+    0x1d00, 0x7340, 0xc0c0, 0xffc0, 0xc0c0, 0x7340, 0x1d00, 0x0000,   // 232
+    0x1d00, 0x7340, 0xd1c0, 0xd1c0, 0x7340, 0x7340, 0xe2c0, 0x0000,   // 233
+    0x1f00, 0x3000, 0x0a00, 0x7e40, 0xd1c0, 0xd1c0, 0x7f40, 0x0000,   // 234
+    0x0000, 0x0000, 0x0000, 0x7f40, 0xccc0, 0xccc0, 0x7f40, 0x0000,   // 235
+    0x01c0, 0x7e00, 0xd280, 0xccc0, 0xccc0, 0xa1c0, 0x2f40, 0xd000,   // 236
+    0x7f00, 0xd000, 0xd000, 0xff00, 0xd000, 0xd000, 0x7f00, 0x0000,   // 237
+    0x7f40, 0xd1c0, 0xc0c0, 0xc0c0, 0xc0c0, 0xc0c0, 0xc0c0, 0x0000,   // 238
+    0x0000, 0xffc0, 0x0000, 0xffc0, 0x0000, 0xffc0, 0x0000, 0x0000,   // 239
+    0x0c00, 0x1d00, 0xffc0, 0x1d00, 0x0c00, 0x0000, 0xffc0, 0x0000,   // 240
+    0x3400, 0x1d00, 0x0300, 0x1d00, 0x3400, 0x0000, 0xffc0, 0x0000,   // 241
+    0x0700, 0x1d00, 0x3000, 0x1d00, 0x0700, 0x0000, 0xffc0, 0x0000,   // 242
+    0x0b80, 0x0cc0, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00,   // 243
+    0x0c00, 0x0c00, 0x0c00, 0x0c00, 0x0c00, 0xcc00, 0xcc00, 0xb800,   // 244
+    0x0a00, 0x0a00, 0x0000, 0xffc0, 0x0000, 0x0a00, 0x0a00, 0x0000,   // 245
+    0x0000, 0xb8c0, 0xcb80, 0x0000, 0xb8c0, 0xcb80, 0x0000, 0x0000,   // 246
+    0x6e40, 0xb380, 0xb380, 0x6e40, 0x0000, 0x0000, 0x0000, 0x0000,   // 247
+    0x0000, 0x0000, 0x0000, 0x0a00, 0x0a00, 0x0000, 0x0000, 0x0000,   // 248
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0f00, 0x0000, 0x0000, 0x0000,   // 249
+    0x0bc0, 0x0d00, 0x0c00, 0x0c00, 0xcc00, 0xcc00, 0x7c00, 0x1c00,   // 250
+    0x2f40, 0x35c0, 0x30c0, 0x30c0, 0x30c0, 0x0000, 0x0000, 0x0000,   // 251
+    0x3e40, 0x03c0, 0x1a40, 0x2c00, 0x2fc0, 0x0000, 0x0000, 0x0000,   // 252
+    0x0000, 0x0000, 0x2f80, 0x3fc0, 0x3fc0, 0x2f80, 0x0000, 0x0000,   // 253
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,   // 254
+};
+
+const struct gfx_font gfx_font_5x7 = {
+    "5x7", 1, 6, 8, 7, 0, 254,
+    font_5x7_rows, font_5x7_runs_index, font_5x7_runs, font_5x7_aa
+};
+
+const struct gfx_font *const gfx_fonts[GFX_FONTS] = {
+    &gfx_font_7x12,
+    &gfx_font_5x7,
+};
@@ -0,0 +1,198 @@
+/*
+ * Copyright (C) 2013 Chuck McManis (cmcmanis@mcmanis.com)
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ */
+
+/*
+ * gfx_glyph.c - a cache of glyphs already turned into pixels
+ *
+ * A clock or a status panel draws the same few characters in the same
+ * colors over and over, and every time gfx_drawChar() unpacks the font
+ * bits again. This keeps the finished RGB565 pixels of recently drawn
+ * glyphs, keyed by font, character, colors and size, so drawing one
+ * of those again is just a window and a burst straight out of RAM.
+ *
+ * The cache is a fixed arena of GFX_GLYPH_CACHE_BYTES (0 turns it
+ * off), handed out in units of 96 pixels (a size 1 glyph of the 7 x 12
+ * font); a glyph takes as many units next to each other as its pixels
+ * need. When there isn't room the least recently used glyphs are
+ * thrown out until there is. More RAM means more glyphs stay cached,
+ * gfx_glyph_stats() shows how well that is working.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "gfx.h"
+
+#ifndef GFX_GLYPH_CACHE_BYTES
+#define GFX_GLYPH_CACHE_BYTES   12288
+#endif
+
+#define GLYPH_UNIT      96      /* pixels in a unit */
+#define GLYPH_UNITS     (GFX_GLYPH_CACHE_BYTES / (GLYPH_UNIT * 2))
+
+static struct gfx_glyph_stats glyph_stats;
+
+#if GLYPH_UNITS > 0
+struct glyph_entry {
+    const struct gfx_font *font;
+    uint16_t    fg, bg;
+    uint8_t     c, size;
+    uint16_t    first;          /* first unit it occupies */
+    uint16_t    units;          /* and how many */
+    uint32_t    used;           /* glyph_clock when last drawn */
+};
+
+static uint16_t glyph_arena[GLYPH_UNITS][GLYPH_UNIT];
+static uint8_t glyph_busy[GLYPH_UNITS];
+static struct glyph_entry glyph_cache[GLYPH_UNITS];
+static uint16_t glyph_count;
+static uint32_t glyph_clock;
+
+/* First of n free units in a row, or -1 */
+static int
+glyph_find(uint16_t n) {
+    uint16_t i, run = 0;
+
+    for (i = 0; i < GLYPH_UNITS; i++) {
+        run = glyph_busy[i] ? 0 : run + 1;
+        if (run == n) {
+            return i + 1 - n;
+        }
+    }
+    return -1;
+}
+
+/* Throw out entry i */
+static void
+glyph_evict(uint16_t i) {
+    uint16_t u;
+
+    for (u = 0; u < glyph_cache[i].units; u++) {
+        glyph_busy[glyph_cache[i].first + u] = 0;
+    }
+    glyph_cache[i] = glyph_cache[--glyph_count];
+}
+
+/*
+ * gfx_glyph_lookup(font, c, fg, bg, size, hit)
+ *
+ * Find the pixels for glyph c of font in these colors and size. If
+ * they are cached *hit is set and they are ready to send. Otherwise
+ * room is made for them, *hit is cleared and the caller has to fill
+ * in the width * height * size * size pixels (a row at a time, top to
+ * bottom).
+ * NULL means the glyph is too big to cache at all.
+ */
+uint16_t *
+gfx_glyph_lookup(const struct gfx_font *font, uint8_t c, uint16_t fg,
+                 uint16_t bg, uint8_t size, int *hit) {
+    uint16_t i, oldest;
+    uint32_t n;
+    int first;
+    struct glyph_entry *e;
+
+    glyph_clock++;
+    for (i = 0; i < glyph_count; i++) {
+        e = &glyph_cache[i];
+        if ((e->c == c) && (e->fg == fg) && (e->bg == bg) &&
+            (e->size == size) && (e->font == font)) {
+            e->used = glyph_clock;
+            glyph_stats.hits++;
+            *hit = 1;
+            return glyph_arena[e->first];
+        }
+    }
+    *hit = 0;
+    n = ((uint32_t) font->width * font->height * size * size +
+         GLYPH_UNIT - 1) / GLYPH_UNIT;
+    if ((n == 0) || (n > GLYPH_UNITS)) {
+        glyph_stats.bypassed++;
+        return NULL;
+    }
+    glyph_stats.misses++;
+    while ((first = glyph_find((uint16_t) n)) < 0) {
+        oldest = 0;
+        for (i = 1; i < glyph_count; i++) {
+            if (glyph_cache[i].used < glyph_cache[oldest].used) {
+                oldest = i;
+            }
+        }
+        glyph_evict(oldest);
+        glyph_stats.evictions++;
+    }
+    for (i = 0; i < n; i++) {
+        glyph_busy[first + i] = 1;
+    }
+    e = &glyph_cache[glyph_count++];
+    e->font = font;
+    e->c = c;
+    e->fg = fg;
+    e->bg = bg;
+    e->size = size;
+    e->first = (uint16_t) first;
+    e->units = (uint16_t) n;
+    e->used = glyph_clock;
+    return glyph_arena[first];
+}
+
+/* Empty the cache */
+void
+gfx_glyph_flush(void) {
+    while (glyph_count) {
+        glyph_evict(glyph_count - 1);
+    }
+}
+
+/* Units (size 1 glyphs) in use right now */
+static uint16_t
+glyph_units_used(void) {
+    uint16_t i, n = 0;
+
+    for (i = 0; i < GLYPH_UNITS; i++) {
+        n += glyph_busy[i];
+    }
+    return n;
+}
+#else
+uint16_t *
+gfx_glyph_lookup(const struct gfx_font *font, uint8_t c, uint16_t fg,
+                 uint16_t bg, uint8_t size, int *hit) {
+    (void) font; (void) c; (void) fg; (void) bg; (void) size;
+    *hit = 0;
+    glyph_stats.bypassed++;
+    return NULL;
+}
+
+void
+gfx_glyph_flush(void) {
+}
+
+#define glyph_count         0
+#define glyph_units_used()  0
+#endif
+
+/*
+ * gfx_glyph_stats(s, reset)
+ *
+ * Copy out the cache counters, and zero them if reset is set.
+ */
+void
+gfx_glyph_stats(struct gfx_glyph_stats *s, int reset) {
+    if (s) {
+        glyph_stats.entries = glyph_count;
+        glyph_stats.units_used = glyph_units_used();
+        glyph_stats.units = GLYPH_UNITS;
+        *s = glyph_stats;
+    }
+    if (reset) {
+        glyph_stats.hits = 0;
+        glyph_stats.misses = 0;
+        glyph_stats.evictions = 0;
+        glyph_stats.bypassed = 0;
+    }
+}
@@ -0,0 +1,147 @@
+/*
+ * Copyright (C) 2013 Chuck McManis (cmcmanis@mcmanis.com)
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ */
+
+/*
+ * gfx_text.c - text fields that only redraw what changed
+ *
+ * A clock or a counter puts a new string in the same place over and
+ * over, and usually only the last digit or two are different. A text
+ * field remembers where it is, how it is drawn and what it showed last
+ * time, so gfx_text_update() can compare the new string against that
+ * and redraw just the character cells that changed.
+ *
+ * Opaque text (bg != fg) covers its whole cell, so a changed character
+ * is simply drawn over the old one (out of the glyph cache if it has
+ * been drawn in those colors before). Transparent text can't erase
+ * the old character by itself, so for that the changed cells are added
+ * to the damage list instead and the caller's gfx_damage_flush() puts
+ * back whatever is behind them, which should include gfx_text_draw().
+ */
+
+#include <stdint.h>
+#include "gfx.h"
+
+/*
+ * gfx_text_init(f, x, y, size, fg, bg)
+ *
+ * Set up a field at x, y in the current font. Nothing is drawn, and
+ * the first update draws every character.
+ */
+void
+gfx_text_init(struct gfx_text *f, int16_t x, int16_t y, uint8_t size,
+              uint16_t fg, uint16_t bg) {
+    f->font = gfx_getFont();
+    f->x = x;
+    f->y = y;
+    f->size = size;
+    f->fg = fg;
+    f->bg = bg;
+    f->len = 0;
+    f->text[0] = 0;
+    f->valid = 0;
+}
+
+/*
+ * gfx_text_invalidate(f)
+ *
+ * Forget what is on the screen (it was cleared, or drawn over), the
+ * next update draws every character again.
+ */
+void
+gfx_text_invalidate(struct gfx_text *f) {
+    f->valid = 0;
+}
+
+/* Redraw cells first to last of f, showing f->text */
+static void
+text_cells(struct gfx_text *f, uint8_t first, uint8_t last) {
+    const struct gfx_font *font = gfx_getFont();
+    int16_t w = f->font->width * f->size;
+    int16_t h = f->font->height * f->size;
+    int16_t x = f->x + first * w;
+
+    if (f->fg == f->bg) {
+        gfx_damage_add(x, f->y, (last - first + 1) * w, h);
+        return;
+    }
+    gfx_setFont(f->font);
+    for (; first <= last; first++, x += w) {
+        if (first < f->len) {
+            gfx_drawChar(x, f->y, (unsigned char) f->text[first], f->fg, f->bg,
+                         f->size);
+        } else {
+            gfx_fillRect(x, f->y, w, h, f->bg);
+        }
+    }
+    gfx_setFont(font);
+}
+
+/*
+ * gfx_text_update(f, s)
+ *
+ * Show s in the field, redrawing only the characters that differ from
+ * what it showed before. If s is shorter the cells left over are
+ * cleared to bg. Returns the number of cells that were redrawn (or,
+ * for transparent text, marked as damaged).
+ */
+int
+gfx_text_update(struct gfx_text *f, const char *s) {
+    uint8_t i, n, old = f->valid ? f->len : 0;
+    int first = -1, cells = 0;
+
+    for (n = 0; (n < GFX_TEXT_MAX) && s[n]; n++)
+        ;
+    f->len = n;
+    for (i = 0; i < n; i++) {
+        if ((i >= old) || (s[i] != f->text[i])) {
+            f->text[i] = s[i];
+            if (first < 0) {
+                first = i;
+            }
+        } else if (first >= 0) {
+            text_cells(f, (uint8_t) first, i - 1);
+            cells += i - first;
+            first = -1;
+        }
+    }
+    f->text[n] = 0;
+    if (old > n) {
+        /* the leftover cells go with any changed run just before them */
+        if (first < 0) {
+            first = n;
+        }
+        i = old;
+    }
+    if (first >= 0) {
+        text_cells(f, (uint8_t) first, i - 1);
+        cells += i - first;
+    }
+    f->valid = 1;
+    return cells;
+}
+
+/*
+ * gfx_text_draw(f)
+ *
+ * Draw the whole field as it was last updated, for a draw function
+ * that repaints the scene (tiles, damage, display lists).
+ */
+void
+gfx_text_draw(struct gfx_text *f) {
+    const struct gfx_font *font = gfx_getFont();
+    int16_t w = f->font->width * f->size;
+    uint8_t i;
+
+    gfx_setFont(f->font);
+    for (i = 0; i < f->len; i++) {
+        gfx_drawChar(f->x + i * w, f->y, (unsigned char) f->text[i], f->fg,
+                     f->bg, f->size);
+    }
+    gfx_setFont(font);
+}
@@ -0,0 +1,231 @@
+/*
+ * Copyright (C) 2013 Chuck McManis (cmcmanis@mcmanis.com)
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ */
+
+/*
+ * gfx_tile.c - render a piece of the screen in RAM, then blast it
+ *
+ * A full 320 x 240 x 16 bit frame is 150K, which doesn't leave much
+ * of the F4 for anything else. But drawing straight onto the panel
+ * means every layer of a widget (fill, then outline, then text) shows
+ * up on its own for a moment, which is the flicker you see in the demo
+ * clock. The compromise is a small tile buffer: the area to be redrawn
+ * is cut into tiles, all of the drawing for one tile is done in RAM
+ * and then the finished tile goes to the panel as a single window
+ * burst (lcd_set_window() and lcd_write_pixels()). Every pixel on the
+ * panel is written exactly once and only with its final color.
+ *
+ * The drawing itself is whatever the caller's draw function does with
+ * the normal gfx_* calls, it is called once per tile with the tile set
+ * as the target (__gfx_state.tile) and the clip rectangle narrowed to
+ * the tile, so anything falling outside it is dropped before any work
+ * is done on it.
+ *
+ * The buffer is GFX_TILE_PIXELS pixels. Define GFX_TILE_CCM to put it
+ * in the 64K core coupled RAM (the linker script needs a .ccmram
+ * section), that keeps it out of main SRAM but note the DMA engine
+ * can't reach CCM. The shape can be changed at run time with
+ * gfx_tile_setsize() as long as it fits; bigger tiles mean fewer
+ * passes through the draw function and fewer window setups, smaller
+ * ones mean less RAM.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include "lcd.h"
+#include "gfx.h"
+
+#ifndef GFX_TILE_W
+#define GFX_TILE_W  64
+#endif
+#ifndef GFX_TILE_H
+#define GFX_TILE_H  48
+#endif
+#ifndef GFX_TILE_PIXELS
+#define GFX_TILE_PIXELS (GFX_TILE_W * GFX_TILE_H)
+#endif
+
+#ifdef GFX_TILE_CCM
+#define GFX_TILE_SECTION __attribute__((section(".ccmram")))
+#else
+#define GFX_TILE_SECTION
+#endif
+
+static uint16_t tile_buf[GFX_TILE_PIXELS] GFX_TILE_SECTION;
+static int16_t tile_w = GFX_TILE_W;
+static int16_t tile_h = GFX_TILE_H;
+static struct gfx_tile_stats tile_stats;
+
+/*
+ * gfx_tile_fill(t, x0, y0, x1, y1, color)
+ *
+ * Fill the screen rectangle x0..x1, y0..y1 (inclusive) in tile t,
+ * whatever part of it falls outside the tile is ignored.
+ */
+void
+gfx_tile_fill(struct gfx_tile *t, int16_t x0, int16_t y0, int16_t x1,
+              int16_t y1, uint16_t color) {
+    uint16_t *p;
+    int16_t x, w;
+
+    if (x0 < t->x) {
+        x0 = t->x;
+    }
+    if (y0 < t->y) {
+        y0 = t->y;
+    }
+    if (x1 >= t->x + t->w) {
+        x1 = t->x + t->w - 1;
+    }
+    if (y1 >= t->y + t->h) {
+        y1 = t->y + t->h - 1;
+    }
+    if ((x0 > x1) || (y0 > y1)) {
+        return;
+    }
+    w = x1 - x0 + 1;
+    for (; y0 <= y1; y0++) {
+        p = t->buf + (y0 - t->y) * t->w + (x0 - t->x);
+        for (x = 0; x < w; x++) {
+            *p++ = color;
+        }
+    }
+}
+
+/*
+ * gfx_tile_write(t, x0, y0, x1, y1, src, stride)
+ *
+ * Copy pixels into the screen rectangle x0..x1, y0..y1 (inclusive) in
+ * tile t. src is the pixel for x0, y0 and its lines are stride pixels
+ * apart, whatever part of it falls outside the tile is ignored.
+ */
+void
+gfx_tile_write(struct gfx_tile *t, int16_t x0, int16_t y0, int16_t x1,
+               int16_t y1, const uint16_t *src, int16_t stride) {
+    uint16_t *p;
+    int16_t x, w;
+
+    if (x0 < t->x) {
+        src += t->x - x0;
+        x0 = t->x;
+    }
+    if (y0 < t->y) {
+        src += (int32_t) (t->y - y0) * stride;
+        y0 = t->y;
+    }
+    if (x1 >= t->x + t->w) {
+        x1 = t->x + t->w - 1;
+    }
+    if (y1 >= t->y + t->h) {
+        y1 = t->y + t->h - 1;
+    }
+    if ((x0 > x1) || (y0 > y1)) {
+        return;
+    }
+    w = x1 - x0 + 1;
+    for (; y0 <= y1; y0++, src += stride) {
+        p = t->buf + (y0 - t->y) * t->w + (x0 - t->x);
+        for (x = 0; x < w; x++) {
+            p[x] = src[x];
+        }
+    }
+}
+
+/*
+ * gfx_tile_setsize(w, h)
+ *
+ * Change the tile shape, returns -1 (and changes nothing) if w * h
+ * doesn't fit in the buffer.
+ */
+int
+gfx_tile_setsize(int16_t w, int16_t h) {
+    if ((w <= 0) || (h <= 0) || ((int32_t) w * h > GFX_TILE_PIXELS)) {
+        return -1;
+    }
+    tile_w = w;
+    tile_h = h;
+    return 0;
+}
+
+/*
+ * gfx_tile_render(x, y, w, h, bg, draw, arg)
+ *
+ * Redraw the screen rectangle x, y, w, h a tile at a time. Each tile
+ * starts out as bg, draw(arg) paints it, then it is flushed as one
+ * burst. The rectangle is clipped to the clip rectangle first.
+ */
+void
+gfx_tile_render(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t bg,
+                gfx_draw_fn draw, void *arg) {
+    struct gfx_tile t;
+    struct gfx_tile *saved;
+    struct gfx_clip clip = __gfx_state.clip;
+    int16_t tx, ty;
+    int32_t x1 = (int32_t) x + w;
+    int32_t y1 = (int32_t) y + h;
+    uint32_t i, n;
+
+    if (x < clip.x0) {
+        x = clip.x0;
+    }
+    if (y < clip.y0) {
+        y = clip.y0;
+    }
+    if (x1 > clip.x1 + 1) {
+        x1 = clip.x1 + 1;
+    }
+    if (y1 > clip.y1 + 1) {
+        y1 = clip.y1 + 1;
+    }
+
+    saved = __gfx_state.tile;
+    t.buf = tile_buf;
+    lcd_set_scan(LCD_SCAN_H);
+    for (ty = y; ty < y1; ty += tile_h) {
+        for (tx = x; tx < x1; tx += tile_w) {
+            t.x = tx;
+            t.y = ty;
+            t.w = (x1 - tx < tile_w) ? x1 - tx : tile_w;
+            t.h = (y1 - ty < tile_h) ? y1 - ty : tile_h;
+            n = (uint32_t) t.w * t.h;
+            for (i = 0; i < n; i++) {
+                tile_buf[i] = bg;
+            }
+
+            __gfx_state.tile = &t;
+            __gfx_state.clip.x0 = t.x;
+            __gfx_state.clip.y0 = t.y;
+            __gfx_state.clip.x1 = t.x + t.w - 1;
+            __gfx_state.clip.y1 = t.y + t.h - 1;
+            draw(arg);
+            __gfx_state.tile = saved;
+            __gfx_state.clip = clip;
+            tile_stats.passes++;
+
+            lcd_set_window(t.x, t.y, t.x + t.w - 1, t.y + t.h - 1);
+            lcd_write_pixels(tile_buf, n);
+            tile_stats.tiles++;
+            tile_stats.pixels += n;
+        }
+    }
+}
+
+/*
+ * gfx_tile_stats(s, reset)
+ *
+ * Copy out the counters, and zero them if reset is set.
+ */
+void
+gfx_tile_stats(struct gfx_tile_stats *s, int reset) {
+    if (s) {
+        *s = tile_stats;
+    }
+    if (reset) {
+        tile_stats.tiles = tile_stats.pixels = tile_stats.passes = 0;
+    }
+}
@@ -41,16 +41,33 @@
  */
 
 #include <stdint.h>
+#ifdef LCD_HOST
+#include "lcd_emu.h"
+#else
 #include <libopencm3/cm3/assert.h>
 #include <libopencm3/stm32/rcc.h>
 #include <libopencm3/stm32/gpio.h>
 #include <libopencm3/stm32/fsmc.h>
+#endif
 #include "lcd.h"
 
 /* XXX: libopencm3 definitions give integer overflow error */
 #define fsmc_bcr1 *((volatile uint32_t *)(0xA0000000))
 #define fsmc_btr1 *((volatile uint32_t *)(0xA0000004))
 
+#ifdef LCD_HOST
+/*
+ * On the host there is no FSMC, the "bus" is the SSD2119 model in
+ * lcd_emu.c and the reset and backlight lines go nowhere.
+ */
+#define gpio_set(port, pins)
+#define gpio_clear(port, pins)
+
+void
+lcd_setup() {
+    lcd_emu_reset();
+}
+#else
 void
 lcd_setup() {
     uint32_t    gpio_pins;
@@ -91,6 +108,7 @@ lcd_setup() {
     /* Controller values 16 bits wide, Write enabled, block enabled */
     fsmc_bcr1 = (1 << 4) | FSMC_BCR_WREN | FSMC_BCR_MBKEN;
 }
+#endif
 
 /*
  * What is the polarity of DC? Is level 1 "command"
@@ -98,55 +116,447 @@ lcd_setup() {
 volatile uint16_t *__lcd_cmd_address =  (uint16_t *)(0x60000000);
 volatile uint16_t *__lcd_data_address = (uint16_t *)(0x60100000);
 
-/* Optimization state */
-#ifdef RAPID_WRITE
-uint16_t __next_x = 500;
-uint16_t __next_y = 500;
-uint16_t __last_reg_used = 0xff;
+/*
+ * Bus cycles. On the board these are just stores to (and loads from)
+ * the two FSMC addresses above. In a host build (LCD_HOST) the same
+ * cycles are handed to the SSD2119 model instead, so everything above
+ * this line can be run and checked without the board.
+ */
+#ifdef LCD_HOST
+#define BUS_WRITE_CMD(c)    lcd_emu_write_cmd((uint16_t)(c))
+#define BUS_WRITE_DATA(d)   lcd_emu_write_data((uint16_t)(d))
+#define BUS_READ_DATA()     lcd_emu_read_data()
+#else
+#define BUS_WRITE_CMD(c)    (*(__lcd_cmd_address) = (uint16_t)(c))
+#define BUS_WRITE_DATA(d)   (*(__lcd_data_address) = (uint16_t)(d))
+#define BUS_READ_DATA()     (*(__lcd_data_address))
 #endif
 
-extern void msleep(int);
+#ifdef LCD_STATS
+/*
+ * Bus cycle counters, one set per scope (see lcd.h). The counting is
+ * wrapped around the cycles themselves so nothing that talks to the
+ * panel can get past it.
+ */
+static struct lcd_bus_stats __stats[LCD_STATS_SCOPES];
+static int __stats_scope;
+static uint16_t __stats_reg = 0xffff;
+
+static inline void
+stats_cmd(uint16_t c) {
+    __stats[__stats_scope].cmd_writes++;
+    if (c != __stats_reg) {
+        __stats[__stats_scope].reg_switches++;
+        __stats_reg = c;
+    }
+}
 
-/* lcd_writereg()
- * Write a value to a "register" in the LCD controller, this
- * is accomplished by writing the register address first with the
- * "DC" bit reset, then writing the data with the DC bit set.
+#define LCD_WRITE_CMD(c)    do { stats_cmd((uint16_t)(c));  \
+                                 BUS_WRITE_CMD(c); } while (0)
+#define LCD_WRITE_DATA(d)   do { __stats[__stats_scope].data_writes++; \
+                                 BUS_WRITE_DATA(d); } while (0)
+#define LCD_READ_DATA()     (__stats[__stats_scope].reads++, BUS_READ_DATA())
+
+/*
+ * lcd_stats_enter(scope)
  *
- * There is an optimization though, if you are writing pixels,
- * the display auto-increments the address counters to the next 
- * pixel to write, so you don't have to resend the X_ADDR and 
- * Y_ADDR addresses.
+ * Count the following cycles against scope, unless a scope is already
+ * open: then the outer one keeps them, so a rounded rectangle is not
+ * reported as the lines and quarter circles it is drawn with. Returns
+ * what to hand to lcd_stats_leave() afterwards.
+ */
+int
+lcd_stats_enter(int scope) {
+    int prev = __stats_scope;
+
+    if ((prev == 0) && (scope > 0) && (scope < LCD_STATS_SCOPES)) {
+        __stats_scope = scope;
+    }
+    return prev;
+}
+
+void
+lcd_stats_leave(int prev) {
+    __stats_scope = prev;
+}
+
+void
+lcd_stats_get(int scope, struct lcd_bus_stats *s) {
+    *s = __stats[scope];
+}
+
+/* Data writes that didn't go through here, see lcd_gram_written() */
+static void
+stats_data(uint32_t n) {
+    __stats[__stats_scope].data_writes += n;
+}
+
+void
+lcd_stats_reset(void) {
+    int i;
+
+    for (i = 0; i < LCD_STATS_SCOPES; i++) {
+        __stats[i].cmd_writes = 0;
+        __stats[i].data_writes = 0;
+        __stats[i].reads = 0;
+        __stats[i].reg_switches = 0;
+    }
+}
+
+extern void uart_puts(char *);
+
+/* Print s and pad it out to width characters */
+static void
+stats_name(const char *s, int width) {
+    char pad[2] = " ";
+
+    uart_puts((char *) s);
+    while (*s++) {
+        width--;
+    }
+    while (width-- > 0) {
+        uart_puts(pad);
+    }
+}
+
+/* Right justify v in a field of width characters */
+static void
+stats_col(uint32_t v, int width) {
+    char buf[12];
+    int i = sizeof(buf) - 1;
+
+    buf[i] = 0;
+    do {
+        buf[--i] = (char)(v % 10) + '0';
+        v /= 10;
+        width--;
+    } while (v && (i > 0));
+    while ((width-- > 0) && (i > 0)) {
+        buf[--i] = ' ';
+    }
+    uart_puts(&buf[i]);
+}
+
+/*
+ * lcd_stats_dump(names, n)
  *
- * This allows for a bit of optimization here such that if the 
- * code is trying to write the next pixel horizontally, AND 
- * there were no intervening commands, then the write just writes
- * the pixel data register. This makes for much faster screen 
- * clears, and slighly faster character drawing.
+ * Print the counters for every scope that saw any traffic as a table
+ * on the UART. names[i] is the name for scope i, there are n of them.
  */
 void
-lcd_writereg(uint8_t addr, uint16_t val) {
-#ifdef RAPID_WRITE
-    if (((addr == X_RAM_ADDR) && (val == __next_x)) ||
-        ((addr == Y_RAM_ADDR) && (val == __next_y)))
-    {
+lcd_stats_dump(const char * const *names, int n) {
+    int i;
+    struct lcd_bus_stats *s;
+
+    uart_puts("scope                  cmd      data      read    switch\n");
+    for (i = 0; i < LCD_STATS_SCOPES; i++) {
+        s = &__stats[i];
+        if ((s->cmd_writes | s->data_writes | s->reads) == 0) {
+            continue;
+        }
+        if ((i < n) && names[i]) {
+            stats_name(names[i], 16);
+        } else {
+            stats_name("scope", 14);
+            stats_col((uint32_t) i, 2);
+        }
+        stats_col(s->cmd_writes, 10);
+        stats_col(s->data_writes, 10);
+        stats_col(s->reads, 10);
+        stats_col(s->reg_switches, 10);
+        uart_puts("\n");
+    }
+}
+#else
+#define LCD_WRITE_CMD(c)    BUS_WRITE_CMD(c)
+#define LCD_WRITE_DATA(d)   BUS_WRITE_DATA(d)
+#define LCD_READ_DATA()     BUS_READ_DATA()
+#define stats_data(n)           (void) (n)
+#endif
+
+/*
+ * Rotation, see lcd_set_rotation(). Callers work in the rotated
+ * coordinates and everything here turns them into GRAM ones. __id is
+ * which way GRAM x and y have to count (ENTRY_MODE ID0/ID1) for the
+ * counter to walk the rotated screen left to right and top to bottom.
+ */
+static uint8_t __rotation;
+static int __scan = LCD_SCAN_H;
+
+static const uint16_t __id[4] = {
+    LCD_ENTRY_ID0 | LCD_ENTRY_ID1,  /* x is GRAM x, y is GRAM y */
+    LCD_ENTRY_ID1,                  /* x is GRAM y, y is GRAM -x */
+    0,                              /* x is GRAM -x, y is GRAM -y */
+    LCD_ENTRY_ID0,                  /* x is GRAM -y, y is GRAM x */
+};
+
+/* The GRAM address of screen x, y */
+static void
+lcd_to_gram(uint16_t *x, uint16_t *y) {
+    uint16_t t;
+
+    switch (__rotation) {
+        case 1:
+            t = *x;
+            *x = LCD_DISPLAY_WIDTH - 1 - *y;
+            *y = t;
+            break;
+        case 2:
+            *x = LCD_DISPLAY_WIDTH - 1 - *x;
+            *y = LCD_DISPLAY_HEIGHT - 1 - *y;
+            break;
+        case 3:
+            t = *x;
+            *x = *y;
+            *y = LCD_DISPLAY_HEIGHT - 1 - t;
+            break;
+        default:
+            break;
+    }
+}
+
+extern void msleep(int);
+
+#if LCD_SHADOW
+/*
+ * The register shadow. Every register value written since the last
+ * reset is remembered (__reg_known says which ones), as is the
+ * register the index points at and where the GRAM address counter
+ * is. That's enough to leave out any write that wouldn't change
+ * anything: setting a register to what it already holds, moving the
+ * counter to where it already is, or reselecting RAM_DATA between
+ * pixels.
+ *
+ * The address counter is followed through every GRAM write the way
+ * the SSD2119 moves it: along a line (or down a column with AM set),
+ * forwards or backwards as ID0/ID1 say, wrapping at the window edges
+ * and back to the start at the end of the window. Anything that makes
+ * its position uncertain (a GRAM read, the counter being outside the
+ * window, a register we haven't written) just forgets it, and the
+ * next X/Y write goes out as normal.
+ */
+static uint16_t __reg[256];
+static uint8_t __reg_known[256 / 8];
+static uint16_t __index = 0xffff;   /* register selected, 0xffff unknown */
+static uint16_t __ac_x, __ac_y;     /* address counter */
+static uint8_t __ac_known;          /* AC_X | AC_Y */
+
+#define AC_X    1
+#define AC_Y    2
+
+#define REG_KNOWN(r)    (__reg_known[(r) >> 3] & (1 << ((r) & 7)))
+
+/* ENTRY_MODE as last written, by lcd_set_scan() or anyone else */
+#define shadow_entry_mode() \
+    (REG_KNOWN(ENTRY_MODE) ? __reg[ENTRY_MODE] : LCD_ENTRY_MODE_DEFAULT)
+
+/* Forget everything, the controller has been reset */
+static void
+shadow_reset(void) {
+    int i;
+
+    for (i = 0; i < (int) sizeof(__reg_known); i++) {
+        __reg_known[i] = 0;
+    }
+    __index = 0xffff;
+    __ac_known = 0;
+}
+
+/* Step one coordinate of the counter, returns 1 if it wrapped */
+static int
+shadow_step(uint16_t *ac, uint16_t start, uint16_t end, int inc) {
+    if (inc) {
+        if (*ac >= end) {
+            *ac = start;
+            return 1;
+        }
+        (*ac)++;
+    } else {
+        if (*ac <= start) {
+            *ac = end;
+            return 1;
+        }
+        (*ac)--;
+    }
+    return 0;
+}
+
+/*
+ * shadow_advance(n)
+ *
+ * Move the counter on by n GRAM accesses. One access is the common
+ * case (lcd_writereg(RAM_DATA, ...)) and is just a step, anything
+ * longer is done by working out how far into the window the counter
+ * is, adding n, and turning that back into x and y.
+ */
+static void
+shadow_advance(uint32_t n) {
+    uint16_t mode, hsa, hea, vsa, vea;
+    uint32_t w, h, along, across, len, pos;
+    int am, inc_x, inc_y;
+
+    if ((__ac_known != (AC_X | AC_Y)) || ! REG_KNOWN(ENTRY_MODE) ||
+        ! REG_KNOWN(H_RAM_START) || ! REG_KNOWN(H_RAM_END) ||
+        ! REG_KNOWN(V_RAM_POS)) {
+        __ac_known = 0;
         return;
     }
-    if ((addr != RAM_DATA) || (__last_reg_used != addr))
-    {
-        __last_reg_used = addr;
-        *(__lcd_cmd_address) = (uint16_t) addr;
+    mode = __reg[ENTRY_MODE];
+    hsa = __reg[H_RAM_START] & 0x1ff;
+    hea = __reg[H_RAM_END] & 0x1ff;
+    vsa = __reg[V_RAM_POS] & 0xff;
+    vea = __reg[V_RAM_POS] >> 8;
+    if ((__ac_x < hsa) || (__ac_x > hea) || (__ac_y < vsa) ||
+        (__ac_y > vea)) {
+        __ac_known = 0;
+        return;
     }
-    *(__lcd_data_address) = val;
-    if (__last_reg_used == RAM_DATA) {
-        __next_x = (__next_x + 1) % LCD_DISPLAY_WIDTH;
-        if (__next_x == 0) {
-            __next_y = (__next_y + 1) & LCD_DISPLAY_HEIGHT;
+    am = (mode & LCD_ENTRY_AM) != 0;
+    inc_x = (mode & LCD_ENTRY_ID0) != 0;
+    inc_y = (mode & LCD_ENTRY_ID1) != 0;
+
+    if (n == 1) {
+        if (am) {
+            if (shadow_step(&__ac_y, vsa, vea, inc_y)) {
+                shadow_step(&__ac_x, hsa, hea, inc_x);
+            }
+        } else {
+            if (shadow_step(&__ac_x, hsa, hea, inc_x)) {
+                shadow_step(&__ac_y, vsa, vea, inc_y);
+            }
         }
+        return;
+    }
+
+    w = hea - hsa + 1;
+    h = vea - vsa + 1;
+    if (am) {
+        along = inc_y ? (uint32_t) (__ac_y - vsa) : (uint32_t) (vea - __ac_y);
+        across = inc_x ? (uint32_t) (__ac_x - hsa) : (uint32_t) (hea - __ac_x);
+        len = h;
+    } else {
+        along = inc_x ? (uint32_t) (__ac_x - hsa) : (uint32_t) (hea - __ac_x);
+        across = inc_y ? (uint32_t) (__ac_y - vsa) : (uint32_t) (vea - __ac_y);
+        len = w;
     }
+    pos = (across * len + along + n % (w * h)) % (w * h);
+    along = pos % len;
+    across = pos / len;
+    if (am) {
+        __ac_y = inc_y ? (uint16_t) (vsa + along) : (uint16_t) (vea - along);
+        __ac_x = inc_x ? (uint16_t) (hsa + across) : (uint16_t) (hea - across);
+    } else {
+        __ac_x = inc_x ? (uint16_t) (hsa + along) : (uint16_t) (hea - along);
+        __ac_y = inc_y ? (uint16_t) (vsa + across) : (uint16_t) (vea - across);
+    }
+}
+
+/* Select a register, unless it already is */
+static void
+shadow_select(uint8_t addr) {
+    if (__index != addr) {
+        LCD_WRITE_CMD(addr);
+        __index = addr;
+    }
+}
+
+#ifdef LCD_SHADOW_CHECK
+#include "lcd_emu.h"
+
+static uint32_t __shadow_errors;
+
+/*
+ * Compare the shadow with the controller model (host builds only).
+ * Every register the shadow knows and the counter, if it knows where
+ * that is, have to match exactly.
+ */
+static void
+shadow_check(void) {
+    uint16_t x, y;
+    int r;
+
+    for (r = 0; r < 256; r++) {
+        if (REG_KNOWN(r) && (r != RAM_DATA) && (r != X_RAM_ADDR) &&
+            (r != Y_RAM_ADDR) && (__reg[r] != lcd_emu_reg((uint8_t) r))) {
+            __shadow_errors++;
+        }
+    }
+    lcd_emu_counter(&x, &y);
+    if (((__ac_known & AC_X) && (x != __ac_x)) ||
+        ((__ac_known & AC_Y) && (y != __ac_y))) {
+        __shadow_errors++;
+    }
+}
+
+/*
+ * lcd_shadow_errors()
+ *
+ * How many times the shadow has disagreed with the controller model.
+ * Anything but 0 is a bug in the shadow.
+ */
+uint32_t
+lcd_shadow_errors(void) {
+    return __shadow_errors;
+}
+#else
+#define shadow_check()
+#endif
 #else
-    *(__lcd_cmd_address) = (uint16_t) addr;
-    *(__lcd_data_address) = val;
+#define shadow_entry_mode()     LCD_ENTRY_MODE_DEFAULT
+#define shadow_reset()
+#define shadow_advance(n)       (void) (n)
+#define shadow_select(addr)     LCD_WRITE_CMD(addr)
+#define shadow_check()
+#endif
+
+/* lcd_writereg()
+ * Write a value to a "register" in the LCD controller, this
+ * is accomplished by writing the register address first with the
+ * "DC" bit reset, then writing the data with the DC bit set.
+ *
+ * With the register shadow (LCD_SHADOW, the default) writes that
+ * wouldn't change anything are left out. In particular the display
+ * auto-increments the address counters to the next pixel to write,
+ * so writing X_ADDR and Y_ADDR for the pixel the counter is already
+ * on costs nothing, and neither does selecting RAM_DATA again for
+ * the next pixel.
+ */
+void
+lcd_writereg(uint8_t addr, uint16_t val) {
+#if LCD_SHADOW
+    switch (addr) {
+        case RAM_DATA:
+            shadow_select(addr);
+            LCD_WRITE_DATA(val);
+            shadow_advance(1);
+            shadow_check();
+            return;
+        case X_RAM_ADDR:
+            if ((__ac_known & AC_X) && (__ac_x == val)) {
+                return;
+            }
+            __ac_x = val & 0x1ff;
+            __ac_known |= AC_X;
+            break;
+        case Y_RAM_ADDR:
+            if ((__ac_known & AC_Y) && (__ac_y == val)) {
+                return;
+            }
+            __ac_y = val & 0xff;
+            __ac_known |= AC_Y;
+            break;
+        default:
+            if (REG_KNOWN(addr) && (__reg[addr] == val)) {
+                return;
+            }
+            break;
+    }
+    __reg[addr] = val;
+    __reg_known[addr >> 3] |= 1 << (addr & 7);
 #endif
+    shadow_select(addr);
+    LCD_WRITE_DATA(val);
+    shadow_check();
 }
 
 /* Read a 16 bit value */
@@ -154,14 +564,30 @@ uint16_t
 lcd_readreg(uint8_t addr) {
     uint16_t result;
 
-    *(__lcd_cmd_address) = (uint16_t) addr;
-#ifdef RAPID_WRITE
-    __last_reg_used = addr;
+    /* always select it, a GRAM read needs the dummy read re-armed */
+    LCD_WRITE_CMD(addr);
+#if LCD_SHADOW
+    __index = addr;
+    if (addr == RAM_DATA) {
+        __ac_known = 0;
+    }
 #endif
-    result = *(__lcd_data_address);
+    result = LCD_READ_DATA();
     return result;
 }
 
+/*
+ * lcd_gram_written(n)
+ *
+ * n pixels went into GRAM without going through this file (DMA, see
+ * lcd_dma.c); keep the counters and the shadow up to date.
+ */
+void
+lcd_gram_written(uint32_t n) {
+    stats_data(n);
+    shadow_advance(n);
+}
+
 /* 16 bit 8080 parallel interface is selected on the board */
 
 void lcd_init() {
@@ -170,6 +596,7 @@ void lcd_init() {
     gpio_clear(GPIOD, LCD_RESET_PIN);
     msleep(100); // Data sheet reccmmends waiting 100mS
     gpio_set(GPIOD, LCD_RESET_PIN);
+    shadow_reset();
 
     gpio_clear(GPIOD, GPIO13); // turn off backlight
 
@@ -192,7 +619,9 @@ void lcd_init() {
     msleep(50);
 	  
     /* Configure pixel color format and MCU interface parameters.*/
-    lcd_writereg(ENTRY_MODE, 0x6830);
+    lcd_writereg(ENTRY_MODE, LCD_ENTRY_MODE_DEFAULT);
+    __rotation = 0;
+    __scan = LCD_SCAN_H;
 
     /* Set analog parameters */
     lcd_writereg(SLEEP_MODE_2, 0x0999);
@@ -237,106 +666,288 @@ void lcd_init() {
     return;
 }
 
+/*
+ * lcd_set_background(r, g, b)
+ *
+ * Paint the whole screen one color, one window and one long burst.
+ * The window is the rotated screen (lcd_width() x lcd_height()).
+ */
 void
 lcd_set_background(int r, int g, int b) {
-    uint32_t    x, y;
-    uint16_t    color = pixel_rgb(r, g, b);
-    for (y = 0; y < LCD_DISPLAY_HEIGHT; y++) {
-        for (x = 0; x < LCD_DISPLAY_WIDTH; x++) {
-            lcd_write_pixel(x, y, color);
-        }
+    lcd_set_window(0, 0, lcd_width() - 1, lcd_height() - 1);
+    lcd_fill_pixels(pixel_rgb(r, g, b),
+                    (uint32_t) lcd_width() * lcd_height());
+}
+
+/*
+ * lcd_set_rotation(r)
+ *
+ * Turn the screen r quarter turns clockwise (0 to 3). Nothing moves on
+ * the glass and nothing is converted per pixel: the coordinates given
+ * to everything in here are rotated into GRAM ones once per window (or
+ * line, or pixel) and ENTRY_MODE is set so the address counter walks
+ * the GRAM window in the rotated order, counting down instead of up
+ * and going down columns instead of along lines as needed. So a
+ * rotated burst is exactly as long as an unrotated one. 1 and 3 make
+ * the screen LCD_DISPLAY_HEIGHT wide and LCD_DISPLAY_WIDTH high.
+ */
+void
+lcd_set_rotation(int r) {
+    __rotation = r & 3;
+    lcd_set_scan(__scan);
+}
+
+/* The width and height of the screen as rotated */
+uint16_t
+lcd_width(void) {
+    return (__rotation & 1) ? LCD_DISPLAY_HEIGHT : LCD_DISPLAY_WIDTH;
+}
+
+uint16_t
+lcd_height(void) {
+    return (__rotation & 1) ? LCD_DISPLAY_WIDTH : LCD_DISPLAY_HEIGHT;
+}
+
+/*
+ * lcd_set_window(x0, y0, x1, y1)
+ *
+ * Restrict GRAM access to the rectangle x0..x1, y0..y1 (inclusive)
+ * and park the address counter on its top left corner. Once that is
+ * done the controller walks the window by itself on every RAM_DATA
+ * write, left to right and then down a line, so a whole rectangle can
+ * be filled with one command write followed by nothing but data
+ * writes (see lcd_write_pixels() and lcd_fill_pixels()).
+ *
+ * Rotated, the window is the GRAM rectangle the screen one lands on
+ * and its "top left" is whichever GRAM corner that turned into, which
+ * is where the counter starts given the directions ENTRY_MODE has it
+ * counting in.
+ *
+ * With the register shadow only the registers that change are
+ * actually written.
+ */
+void
+lcd_set_window(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1) {
+    uint16_t t;
+
+    if (x1 >= lcd_width()) {
+        x1 = lcd_width() - 1;
     }
+    if (y1 >= lcd_height()) {
+        y1 = lcd_height() - 1;
+    }
+    lcd_to_gram(&x0, &y0);
+    lcd_to_gram(&x1, &y1);
+    if (x1 < x0) {
+        t = x0; x0 = x1; x1 = t;
+    }
+    if (y1 < y0) {
+        t = y0; y0 = y1; y1 = t;
+    }
+    lcd_writereg(V_RAM_POS, (y1 << 8) | y0);
+    lcd_writereg(H_RAM_START, x0);
+    lcd_writereg(H_RAM_END, x1);
+    lcd_writereg(X_RAM_ADDR, (__id[__rotation] & LCD_ENTRY_ID0) ? x0 : x1);
+    lcd_writereg(Y_RAM_ADDR, (__id[__rotation] & LCD_ENTRY_ID1) ? y0 : y1);
 }
 
-/* simple optimization to know that the next pixel
- * written is already set. 
+/*
+ * lcd_set_scan(dir)
+ *
+ * Choose the order in which the address counter walks the window.
+ * LCD_SCAN_H (the default) goes along a line and then down to the next,
+ * LCD_SCAN_V (the AM bit in ENTRY_MODE) goes down a column and then on
+ * to the next one. Column ordered data can then be streamed without
+ * setting an address per column. The other ENTRY_MODE bits are kept
+ * as the shadow last saw them, and the shadow leaves the write out
+ * when nothing changes.
+ *
+ * Both are in the rotated screen's terms: on its side a line of the
+ * screen is a column of GRAM, so AM is the other way round, and the
+ * increment bits are whatever the rotation needs.
+ */
+void
+lcd_set_scan(int dir) {
+    uint16_t mode;
+
+    __scan = dir;
+    mode = shadow_entry_mode();
+    mode &= ~(LCD_ENTRY_AM | LCD_ENTRY_ID0 | LCD_ENTRY_ID1);
+    mode |= __id[__rotation];
+    if ((dir == LCD_SCAN_V) != (__rotation & 1)) {
+        mode |= LCD_ENTRY_AM;
+    }
+    lcd_writereg(ENTRY_MODE, mode);
+}
+
+/* The scan direction last set with lcd_set_scan() */
+int
+lcd_scan(void) {
+    return __scan;
+}
+
+/*
+ * lcd_write_pixels(buf, n)
+ *
+ * Stream n pixels from buf into the current window, starting wherever
+ * the address counter is. There is exactly one command write (RAM_DATA)
+ * and then n data writes, so consecutive calls carry on where the last
+ * one stopped.
+ */
+void
+lcd_write_pixels(const uint16_t *buf, uint32_t n) {
+    uint32_t i;
+
+    shadow_select(RAM_DATA);
+    for (i = 0; i < n; i++) {
+        LCD_WRITE_DATA(buf[i]);
+    }
+    shadow_advance(n);
+    shadow_check();
+}
+
+/*
+ * lcd_fill_pixels(color, n)
+ *
+ * Like lcd_write_pixels() but every pixel is the same color.
+ */
+void
+lcd_fill_pixels(uint16_t color, uint32_t n) {
+    uint32_t i;
+
+    shadow_select(RAM_DATA);
+    for (i = 0; i < n; i++) {
+        LCD_WRITE_DATA(color);
+    }
+    shadow_advance(n);
+    shadow_check();
+}
+
+/* Write one pixel anywhere on the screen. The register shadow
+ * leaves out whatever is already set up: the whole screen window,
+ * and X/Y when the pixel is the one after the last one written.
  */
 void
 lcd_write_pixel(uint16_t x, uint16_t y, uint16_t color) {
+    lcd_to_gram(&x, &y);
+    lcd_set_scan(LCD_SCAN_H);
+    lcd_writereg(V_RAM_POS, (LCD_DISPLAY_HEIGHT - 1) << 8);
+    lcd_writereg(H_RAM_START, 0);
+    lcd_writereg(H_RAM_END, LCD_DISPLAY_WIDTH - 1);
     lcd_writereg(X_RAM_ADDR, x);
     lcd_writereg(Y_RAM_ADDR, y);
     lcd_writereg(RAM_DATA, color);
 }
-#define LCD_PIXEL_WIDTH          320
-#define LCD_PIXEL_HEIGHT         240
 
+/*
+ * lcd_fill_line(x, y, n, dir, color)
+ *
+ * n pixels of color from x, y going right (LCD_SCAN_H) or down
+ * (LCD_SCAN_V), which must stay on the screen. Like lcd_write_pixel()
+ * this uses the whole screen window, so a run of lines (a circle, a
+ * line drawn a slice at a time) costs an X and a Y per line instead of
+ * a new window each time.
+ */
+void
+lcd_fill_line(uint16_t x, uint16_t y, uint16_t n, int dir, uint16_t color) {
+    lcd_to_gram(&x, &y);
+    lcd_set_scan(dir);
+    lcd_writereg(V_RAM_POS, (LCD_DISPLAY_HEIGHT - 1) << 8);
+    lcd_writereg(H_RAM_START, 0);
+    lcd_writereg(H_RAM_END, LCD_DISPLAY_WIDTH - 1);
+    lcd_writereg(X_RAM_ADDR, x);
+    lcd_writereg(Y_RAM_ADDR, y);
+    lcd_fill_pixels(color, n);
+}
+
+/*
+ * Paint a 32 line bar at y whose color depends only on the column.
+ * The bar is walked a column at a time (LCD_SCAN_V) so a run of
+ * columns that share a color is a single fill.
+ */
+static void
+lcd_rgb_bar(uint16_t y, const uint16_t *colors) {
+    uint16_t x, run;
+
+    lcd_set_scan(LCD_SCAN_V);
+    lcd_set_window(0, y, LCD_DISPLAY_WIDTH - 1, y + 31);
+    for (x = 0; x < LCD_DISPLAY_WIDTH; x += run) {
+        for (run = 1; (x + run < LCD_DISPLAY_WIDTH) &&
+                      (colors[x + run] == colors[x]); run++) ;
+        lcd_fill_pixels(colors[x], (uint32_t) run * 32);
+    }
+    lcd_set_scan(LCD_SCAN_H);
+}
+
+/* Solid rectangle x0..x1, y0..y1 */
+static void
+lcd_rgb_fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+             uint16_t color) {
+    lcd_set_window(x0, y0, x1, y1);
+    lcd_fill_pixels(color, (uint32_t) (x1 - x0 + 1) * (y1 - y0 + 1));
+}
+
+/*
+ * lcd_rgb_test()
+ *
+ * The test pattern is laid out for the panel as it is, so it is
+ * always drawn at rotation 0; the rotation and scan direction the
+ * caller had are put back afterwards.
+ */
 void
 lcd_rgb_test()
 {
-    uint32_t index, y;
-    uint16_t    grey;
+    uint32_t index;
+    uint16_t    colors[LCD_DISPLAY_WIDTH];
     int         r, g, b;
+    int         rot = __rotation, scan = __scan;
 
-    grey = 0;
-    for (index = 0; index < LCD_DISPLAY_WIDTH; index ++) {
-        r = index / 10; // 0 - 31
-        grey = pixel_rgb(r << 3, r << 3, r << 3);
-        for (y = 0; y < 32; y++) {
-            lcd_write_pixel(index, y, grey);
-        }
-    }
-    /* Red bar */
-    for (index = 0; index < LCD_DISPLAY_WIDTH; index ++) {
-        for (y = 0; y < 32; y++) {
-            lcd_write_pixel(index, y+32, pixel_rgb(0xff, 0, 0));
-        }
-    }
+    lcd_set_rotation(0);
 
-    /* Green bar */
     for (index = 0; index < LCD_DISPLAY_WIDTH; index ++) {
-        for (y = 0; y < 32; y++) {
-            lcd_write_pixel(index, y+64, pixel_rgb(0, 0xff, 0));
-        }
+        r = index / 10; // 0 - 31
+        colors[index] = pixel_rgb(r << 3, r << 3, r << 3);
     }
+    lcd_rgb_bar(0, colors);
 
-    /* Blue bar */
-    for (index = 0; index < LCD_DISPLAY_WIDTH; index ++) {
-        for (y = 0; y < 32; y++) {
-            lcd_write_pixel(index, y+96, pixel_rgb(0, 0, 0xff));
-        }
-    }
+    /* Red, Green and Blue bars */
+    lcd_rgb_fill(0, 32, LCD_DISPLAY_WIDTH - 1, 63, pixel_rgb(0xff, 0, 0));
+    lcd_rgb_fill(0, 64, LCD_DISPLAY_WIDTH - 1, 95, pixel_rgb(0, 0xff, 0));
+    lcd_rgb_fill(0, 96, LCD_DISPLAY_WIDTH - 1, 127, pixel_rgb(0, 0, 0xff));
 
     /* technicolor bar */
     for (index = 0; index < LCD_DISPLAY_WIDTH; index ++) {
         r = index/10;
         g = (index/10 + 5) % 31;
         b = (index/10 + 10) % 31;
-        grey = pixel_rgb(r << 3, g << 3, b << 3);
-        for (y = 0; y < 32; y++) {
-            lcd_write_pixel(index, y+128, grey);
-        }
+        colors[index] = pixel_rgb(r << 3, g << 3, b << 3);
     }
+    lcd_rgb_bar(128, colors);
 
     for (index = 0; index < LCD_DISPLAY_WIDTH; index ++) {
         r = (index/10 + 2) % 31;
         g = (index/10 + 8) % 31;
         b = (index/10 + 16) % 31;
-        grey = pixel_rgb(r << 3, g << 3, b << 3);
-        for (y = 0; y < 32; y++) {
-            lcd_write_pixel(index, y+160, grey);
-        }
+        colors[index] = pixel_rgb(r << 3, g << 3, b << 3);
     }
+    lcd_rgb_bar(160, colors);
 
     for (index = 0; index < LCD_DISPLAY_WIDTH; index ++) {
         r = (index/10 + 3) % 31;
         g = (index/10 + 7) % 31;
         b = (index/10 + 5) % 31;
-        grey = pixel_rgb(r << 3, g << 3, b << 3);
-        for (y = 0; y < 32; y++) {
-            lcd_write_pixel(index, y+192, grey);
-        }
+        colors[index] = pixel_rgb(r << 3, g << 3, b << 3);
     }
+    lcd_rgb_bar(192, colors);
 	  
     /* Border */
-    for (index = 0; index < 320; index++) {
-        lcd_write_pixel(index, 0, 0xffff);
-        lcd_write_pixel(index, 239, 0xffff);
-    }
-    for (index = 0; index < 240; index++) {
-        lcd_write_pixel(0, index, 0xffff);
-        lcd_write_pixel(319, index, 0xffff);
-    }
-    
+    lcd_rgb_fill(0, 0, LCD_DISPLAY_WIDTH - 1, 0, 0xffff);
+    lcd_rgb_fill(0, LCD_DISPLAY_HEIGHT - 1, LCD_DISPLAY_WIDTH - 1,
+                 LCD_DISPLAY_HEIGHT - 1, 0xffff);
+    lcd_rgb_fill(0, 0, 0, LCD_DISPLAY_HEIGHT - 1, 0xffff);
+    lcd_rgb_fill(LCD_DISPLAY_WIDTH - 1, 0, LCD_DISPLAY_WIDTH - 1,
+                 LCD_DISPLAY_HEIGHT - 1, 0xffff);
+
+    lcd_set_rotation(rot);
+    lcd_set_scan(scan);
 }
-
-
@@ -18,9 +18,71 @@ void lcd_reset(void);
 void lcd_set_background(int, int, int);
 void lcd_writereg(uint8_t, uint16_t);
 void lcd_write_pixel(uint16_t, uint16_t, uint16_t);
+void lcd_fill_line(uint16_t, uint16_t, uint16_t, int, uint16_t);
 uint16_t lcd_readreg(uint8_t);
 void lcd_rgb_test(void);
 
+/* windowed bursts, see lcd_set_window() */
+void lcd_set_window(uint16_t, uint16_t, uint16_t, uint16_t);
+void lcd_write_pixels(const uint16_t *, uint32_t);
+void lcd_fill_pixels(uint16_t, uint32_t);
+void lcd_set_scan(int);
+int lcd_scan(void);
+
+/* quarter turns clockwise, 0 to 3; the screen size as rotated */
+void lcd_set_rotation(int);
+uint16_t lcd_width(void);
+uint16_t lcd_height(void);
+
+/* pixels written to GRAM behind lcd.c's back (DMA) */
+void lcd_gram_written(uint32_t);
+
+/*
+ * Register shadow (lcd.c): redundant register writes are left out.
+ * On unless built with -DLCD_SHADOW=0. A host build with
+ * LCD_SHADOW_CHECK defined compares the shadow with the controller
+ * model after every access and counts the differences.
+ */
+#ifndef LCD_SHADOW
+#define LCD_SHADOW  1
+#endif
+#if LCD_SHADOW && defined(LCD_SHADOW_CHECK)
+uint32_t lcd_shadow_errors(void);
+#endif
+
+/* lcd_set_scan() directions */
+#define LCD_SCAN_H  0
+#define LCD_SCAN_V  1
+
+/*
+ * Bus cycle counters (build with -DLCD_STATS). Every command write,
+ * data write and read is counted against the current scope, which a
+ * caller sets with lcd_stats_enter() (gfx.c uses one per primitive).
+ * Scope 0 is everything outside a scope. Without LCD_STATS all of
+ * this compiles to nothing.
+ */
+#define LCD_STATS_SCOPES    32
+
+struct lcd_bus_stats {
+    uint32_t cmd_writes;    /* register address (DC low) writes */
+    uint32_t data_writes;   /* register or GRAM data writes */
+    uint32_t reads;         /* data reads */
+    uint32_t reg_switches;  /* command writes that changed the register */
+};
+
+#ifdef LCD_STATS
+int lcd_stats_enter(int);
+void lcd_stats_leave(int);
+void lcd_stats_get(int, struct lcd_bus_stats *);
+void lcd_stats_reset(void);
+void lcd_stats_dump(const char * const *, int);
+#else
+#define lcd_stats_enter(scope)          0
+#define lcd_stats_leave(prev)
+#define lcd_stats_reset()
+#define lcd_stats_dump(names, n)
+#endif
+
 /* create a 16 bit RGB pixel */
 #define pixel_rgb(r,g,b) ((uint16_t) (((r) & 0xf8) << 8) |\
                                 (((g) & 0xfc) << 3) | \
@@ -69,6 +131,12 @@ void lcd_rgb_test(void);
 #define X_RAM_ADDR        0x4E
 #define Y_RAM_ADDR        0x4F
 
+/* ENTRY_MODE bits */
+#define LCD_ENTRY_AM            0x0008  /* address counter goes down first */
+#define LCD_ENTRY_ID0           0x0010  /* X increments */
+#define LCD_ENTRY_ID1           0x0020  /* Y increments */
+#define LCD_ENTRY_MODE_DEFAULT  0x6830  /* 65k color, X and Y increment */
+
 /* Display Size */
 #define LCD_DISPLAY_WIDTH   320
 #define LCD_DISPLAY_HEIGHT  240
@@ -0,0 +1,996 @@
+/*
+ * Copyright (C) 2013 Chuck McManis (cmcmanis@mcmanis.com)
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ */
+
+/*
+ * lcd_bench.c - time every gfx primitive
+ *
+ * Runs a fixed set of workloads and prints, for each one, how many
+ * primitives it drew, how long that took, primitives and pixels per
+ * second and LCD bus cycles per primitive. The workloads use their
+ * own pseudo random numbers so every run (and every build) draws
+ * exactly the same thing, which makes the bus counts comparable from
+ * one commit to the next.
+ *
+ * Build it with "make lcd_bench" for the board, or with
+ * "make -f Makefile.host" which builds lcd_bench.host to run against
+ * the SSD2119 model. The bus column needs the model (host) or a
+ * LCD_STATS build (board), otherwise it shows '-'. Pixels are the
+ * nominal area each primitive covers, not a count of bus writes.
+ * A PROF build also times single lines and glyphs (prof.h).
+ *
+ * mtime() only counts milliseconds, so anything quicker than
+ * BENCH_MIN_MS is run again (the same primitives, from the same seed)
+ * until that much time has gone by and the rates come from the total.
+ * The bus columns only count the first run, so they don't depend on
+ * how fast the machine is.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#ifdef LCD_HOST
+#include "lcd_emu.h"
+#endif
+#include "lcd.h"
+#include "util.h"
+#include "gfx.h"
+#include "prof.h"
+
+/* Workloads are all drawn over the same background */
+#define BENCH_BG    GFX_COLOR_BLACK
+
+/* Shortest time anything is timed over */
+#define BENCH_MIN_MS    100
+
+static uint32_t bench_seed;
+
+/* A small LCG, the same sequence on every machine */
+static uint16_t
+bench_rand(uint16_t range) {
+    bench_seed = bench_seed * 1103515245 + 12345;
+    return (uint16_t) ((bench_seed >> 16) % range);
+}
+
+static uint16_t
+bench_color(void) {
+    return (uint16_t) (bench_rand(0xffff) | 0x0841);
+}
+
+static int16_t
+bench_abs(int16_t v) {
+    return (v < 0) ? -v : v;
+}
+
+/*
+ * Each workload draws n primitives and returns the pixels they cover.
+ */
+static uint32_t
+bench_clear(uint16_t n) {
+    uint32_t px = 0;
+
+    while (n--) {
+        gfx_fillScreen(bench_color());
+        px += (uint32_t) GFX_WIDTH * GFX_HEIGHT;
+    }
+    return px;
+}
+
+static uint32_t
+bench_rects(uint16_t n) {
+    uint32_t px = 0;
+    int16_t x, y, w, h;
+
+    while (n--) {
+        w = bench_rand(120) + 1;
+        h = bench_rand(90) + 1;
+        x = bench_rand(GFX_WIDTH - w);
+        y = bench_rand(GFX_HEIGHT - h);
+        gfx_fillRect(x, y, w, h, bench_color());
+        px += (uint32_t) w * h;
+    }
+    return px;
+}
+
+static uint32_t
+bench_hlines(uint16_t n) {
+    uint32_t px = 0;
+    int16_t x, w;
+
+    while (n--) {
+        w = bench_rand(GFX_WIDTH) + 1;
+        x = bench_rand(GFX_WIDTH - w + 1);
+        gfx_drawFastHLine(x, bench_rand(GFX_HEIGHT), w, bench_color());
+        px += w;
+    }
+    return px;
+}
+
+static uint32_t
+bench_vlines(uint16_t n) {
+    uint32_t px = 0;
+    int16_t y, h;
+
+    while (n--) {
+        h = bench_rand(GFX_HEIGHT) + 1;
+        y = bench_rand(GFX_HEIGHT - h + 1);
+        gfx_drawFastVLine(bench_rand(GFX_WIDTH), y, h, bench_color());
+        px += h;
+    }
+    return px;
+}
+
+static uint32_t
+bench_lines(uint16_t n) {
+    uint32_t px = 0;
+    int16_t x0, y0, x1, y1, dx, dy;
+
+    while (n--) {
+        x0 = bench_rand(GFX_WIDTH);
+        y0 = bench_rand(GFX_HEIGHT);
+        x1 = bench_rand(GFX_WIDTH);
+        y1 = bench_rand(GFX_HEIGHT);
+        PROF_BEGIN(line);
+        gfx_drawLine(x0, y0, x1, y1, bench_color());
+        PROF_END(line);
+        dx = bench_abs(x1 - x0);
+        dy = bench_abs(y1 - y0);
+        px += ((dx > dy) ? dx : dy) + 1;
+    }
+    return px;
+}
+
+/*
+ * A strip chart: a trace of short, mostly flat segments left to right
+ * that wanders a little past the top and bottom, so some of it is
+ * clipped.
+ */
+static uint32_t
+bench_chart(uint16_t n) {
+    uint32_t px = 0;
+    int16_t x0 = 0, y0 = GFX_HEIGHT / 2, x1, y1, dy;
+
+    while (n--) {
+        x1 = x0 + bench_rand(32) + 8;
+        y1 = y0 + bench_rand(25) - 12;
+        if ((y1 < -20) || (y1 >= GFX_HEIGHT + 20)) {
+            y1 = GFX_HEIGHT / 2;
+        }
+        gfx_drawLine(x0, y0, x1, y1, bench_color());
+        dy = bench_abs(y1 - y0);
+        px += ((x1 - x0 > dy) ? x1 - x0 : dy) + 1;
+        if (x1 >= GFX_WIDTH) {
+            x1 = 0;
+        }
+        x0 = x1;
+        y0 = y1;
+    }
+    return px;
+}
+
+static uint32_t
+bench_circles(uint16_t n) {
+    uint32_t px = 0;
+    int16_t r;
+
+    while (n--) {
+        r = bench_rand(50) + 2;
+        gfx_drawCircle(bench_rand(GFX_WIDTH - 2*r) + r,
+                       bench_rand(GFX_HEIGHT - 2*r) + r, r, bench_color());
+        px += (uint32_t) r * 44 / 7;
+    }
+    return px;
+}
+
+static uint32_t
+bench_fill_circles(uint16_t n) {
+    uint32_t px = 0;
+    int16_t r;
+
+    while (n--) {
+        r = bench_rand(50) + 2;
+        gfx_fillCircle(bench_rand(GFX_WIDTH - 2*r) + r,
+                       bench_rand(GFX_HEIGHT - 2*r) + r, r, bench_color());
+        px += (uint32_t) r * r * 22 / 7;
+    }
+    return px;
+}
+
+/*
+ * Filled circles anywhere on the screen drawn into a clip rectangle a
+ * quarter of its size, the way a widget is, so most are cut down or
+ * thrown out altogether.
+ */
+static uint32_t
+bench_clipped(uint16_t n) {
+    uint32_t px = 0;
+    int16_t r;
+
+    gfx_pushClip(GFX_WIDTH / 4, GFX_HEIGHT / 4, GFX_WIDTH / 2, GFX_HEIGHT / 2);
+    while (n--) {
+        r = bench_rand(50) + 2;
+        gfx_fillCircle(bench_rand(GFX_WIDTH - 2*r) + r,
+                       bench_rand(GFX_HEIGHT - 2*r) + r, r, bench_color());
+        px += (uint32_t) r * r * 22 / 7;
+    }
+    gfx_popClip();
+    return px;
+}
+
+/*
+ * Triangle meshes: a grid of MESH_COLS x MESH_ROWS cells with its
+ * inner points nudged about, drawn as one strip per row (joined by
+ * repeating a vertex) in a single gfx_fillMesh() call.
+ */
+#define MESH_COLS   6
+#define MESH_ROWS   4
+#define MESH_CELL   12
+
+static uint32_t
+bench_mesh(uint16_t n) {
+    static struct gfx_vertex v[(MESH_COLS + 1) * (MESH_ROWS + 1)];
+    static uint16_t index[MESH_ROWS * (2 * MESH_COLS + 4)];
+    struct gfx_mesh m = { v, index, 0, GFX_MESH_STRIP };
+    uint32_t px = 0;
+    int16_t x0, y0;
+    int i, j, k;
+
+    for (j = 0; j < MESH_ROWS; j++) {
+        if (j) {
+            index[m.count] = index[m.count - 1];
+            m.count++;
+            index[m.count++] = j * (MESH_COLS + 1);
+        }
+        for (i = 0; i <= MESH_COLS; i++) {
+            index[m.count++] = j * (MESH_COLS + 1) + i;
+            index[m.count++] = (j + 1) * (MESH_COLS + 1) + i;
+        }
+    }
+    while (n--) {
+        x0 = bench_rand(GFX_WIDTH - MESH_COLS * MESH_CELL);
+        y0 = bench_rand(GFX_HEIGHT - MESH_ROWS * MESH_CELL);
+        for (j = 0, k = 0; j <= MESH_ROWS; j++) {
+            for (i = 0; i <= MESH_COLS; i++, k++) {
+                v[k].x = x0 + i * MESH_CELL;
+                v[k].y = y0 + j * MESH_CELL;
+                if ((i > 0) && (i < MESH_COLS) && (j > 0) && (j < MESH_ROWS)) {
+                    v[k].x += bench_rand(7) - 3;
+                    v[k].y += bench_rand(7) - 3;
+                }
+            }
+        }
+        gfx_fillMesh(&m, bench_color());
+        px += MESH_COLS * MESH_CELL * MESH_ROWS * MESH_CELL;
+    }
+    return px;
+}
+
+static uint32_t
+bench_triangles(uint16_t n, int fill) {
+    uint32_t px = 0;
+    int16_t x[3], y[3];
+    int32_t area;
+    int i;
+
+    while (n--) {
+        for (i = 0; i < 3; i++) {
+            x[i] = bench_rand(GFX_WIDTH);
+            y[i] = bench_rand(GFX_HEIGHT);
+        }
+        if (fill) {
+            gfx_fillTriangle(x[0], y[0], x[1], y[1], x[2], y[2],
+                             bench_color());
+            area = (int32_t) (x[1] - x[0]) * (y[2] - y[0]) -
+                   (int32_t) (x[2] - x[0]) * (y[1] - y[0]);
+            px += (uint32_t) ((area < 0) ? -area : area) / 2;
+        } else {
+            gfx_drawTriangle(x[0], y[0], x[1], y[1], x[2], y[2],
+                             bench_color());
+            for (i = 0; i < 3; i++) {
+                int16_t dx = bench_abs(x[(i + 1) % 3] - x[i]);
+                int16_t dy = bench_abs(y[(i + 1) % 3] - y[i]);
+                px += (dx > dy) ? dx : dy;
+            }
+        }
+    }
+    return px;
+}
+
+static uint32_t
+bench_round_rects(uint16_t n, int fill) {
+    uint32_t px = 0;
+    int16_t x, y, w, h;
+
+    while (n--) {
+        w = bench_rand(120) + 20;
+        h = bench_rand(90) + 20;
+        x = bench_rand(GFX_WIDTH - w);
+        y = bench_rand(GFX_HEIGHT - h);
+        if (fill) {
+            gfx_fillRoundRect(x, y, w, h, 8, bench_color());
+            px += (uint32_t) w * h;
+        } else {
+            gfx_drawRoundRect(x, y, w, h, 8, bench_color());
+            px += 2 * (uint32_t) (w + h);
+        }
+    }
+    return px;
+}
+
+/* 32 x 32 checkerboard of 4 x 4 squares */
+static uint8_t bench_bits[32 * 4];
+
+static uint32_t
+bench_bitmaps(uint16_t n) {
+    uint32_t px = 0;
+    int i;
+
+    for (i = 0; i < (int) sizeof(bench_bits); i++) {
+        bench_bits[i] = ((i / 16) & 1) ? 0x0f : 0xf0;
+    }
+    while (n--) {
+        gfx_drawBitmap(bench_rand(GFX_WIDTH - 32), bench_rand(GFX_HEIGHT - 32),
+                       bench_bits, 32, 32, bench_color());
+        px += 32 * 32;
+    }
+    return px;
+}
+
+/*
+ * Pieces of a bigger image: a 40 x 30 part of a 64 x 48 RGB565 image,
+ * and a 24 x 32 part (from column 4) of the 32 x 32 bitmap drawn
+ * opaque, both blitted with the source's own stride.
+ */
+#define IMAGE_W     64
+#define IMAGE_H     48
+
+static uint16_t bench_image[IMAGE_W * IMAGE_H];
+
+static uint32_t
+bench_images(uint16_t n) {
+    uint32_t px = 0;
+    int16_t x, y;
+    int i;
+
+    for (i = 0; i < IMAGE_W * IMAGE_H; i++) {
+        bench_image[i] = ((i % IMAGE_W) << 11) | ((i / IMAGE_W) << 5) |
+                         (i & 0x1f);
+    }
+    while (n--) {
+        x = bench_rand(IMAGE_W - 40);
+        y = bench_rand(IMAGE_H - 30);
+        gfx_drawRGBBitmap(bench_rand(GFX_WIDTH - 40),
+                          bench_rand(GFX_HEIGHT - 30),
+                          &bench_image[y * IMAGE_W + x], 40, 30, IMAGE_W);
+        px += 40 * 30;
+    }
+    return px;
+}
+
+static uint32_t
+bench_opaque_bitmaps(uint16_t n) {
+    uint32_t px = 0;
+    int i;
+
+    for (i = 0; i < (int) sizeof(bench_bits); i++) {
+        bench_bits[i] = ((i / 16) & 1) ? 0x0f : 0xf0;
+    }
+    while (n--) {
+        gfx_drawBitmapOpaque(bench_rand(GFX_WIDTH - 24),
+                             bench_rand(GFX_HEIGHT - 32), bench_bits, 24, 32,
+                             bench_color(), BENCH_BG, 4, 4);
+        px += 24 * 32;
+    }
+    return px;
+}
+
+static uint32_t
+bench_text(uint16_t n, uint8_t size) {
+    uint32_t px = 0;
+    int16_t w = gfx_getFont()->width * size;
+    int16_t h = gfx_getFont()->height * size;
+    int16_t x, y;
+    unsigned char c;
+
+    while (n--) {
+        x = bench_rand(GFX_WIDTH - w);
+        y = bench_rand(GFX_HEIGHT - h);
+        c = (unsigned char) (' ' + bench_rand(95));
+        PROF_BEGIN(glyph);
+        gfx_drawChar(x, y, c, bench_color(), BENCH_BG, size);
+        PROF_END(glyph);
+        px += (uint32_t) w * h;
+    }
+    return px;
+}
+
+/*
+ * The same text drawn a pixel at a time, the way every size was
+ * before glyph rows were widened once, to show what that saves.
+ */
+static uint32_t
+bench_pixel_text(uint16_t n, uint8_t size) {
+    uint32_t px;
+
+    __gfx_state.charpixels = 1;
+    px = bench_text(n, size);
+    __gfx_state.charpixels = 0;
+    return px;
+}
+
+/* Anti-aliased text, opaque on the usual background */
+static uint32_t
+bench_aa_text(uint16_t n, uint8_t size) {
+    uint32_t px = 0;
+    int16_t w = 8 * size;
+    int16_t h = 12 * size;
+
+    while (n--) {
+        gfx_drawCharAA(bench_rand(GFX_WIDTH - w), bench_rand(GFX_HEIGHT - h),
+                       (unsigned char) (' ' + bench_rand(95)), bench_color(),
+                       BENCH_BG, size);
+        px += (uint32_t) w * h;
+    }
+    return px;
+}
+
+/* The same in the 5 x 7 font */
+static uint32_t
+bench_small_text(uint16_t n, uint8_t size) {
+    uint32_t px;
+
+    gfx_setFont(&gfx_font_5x7);
+    px = bench_text(n, size);
+    gfx_setFont(&gfx_font_7x12);
+    return px;
+}
+
+/* A clock's worth of characters in one color, what the glyph cache is for */
+static uint32_t
+bench_digits(uint16_t n) {
+    static const char digits[] = "0123456789:.";
+    uint32_t px = 0;
+
+    while (n--) {
+        gfx_drawChar(bench_rand(GFX_WIDTH - 16), bench_rand(GFX_HEIGHT - 24),
+                     digits[bench_rand(sizeof(digits) - 1)], GFX_COLOR_YELLOW,
+                     GFX_COLOR_BLUE, 2);
+        px += 16 * 24;
+    }
+    return px;
+}
+
+/* Transparent text, as a label over a picture would be drawn */
+static uint32_t
+bench_labels(uint16_t n, uint8_t size) {
+    uint32_t px = 0;
+    uint16_t color;
+
+    while (n--) {
+        color = bench_color();
+        gfx_drawChar(bench_rand(GFX_WIDTH - 8 * size),
+                     bench_rand(GFX_HEIGHT - 12 * size),
+                     (unsigned char) (' ' + bench_rand(95)), color, color, size);
+        px += 8 * size * 12 * size;
+    }
+    return px;
+}
+
+/* The demo's clock panel, drawn once per tile by the tile renderer */
+#define PANEL_X     40
+#define PANEL_Y     104
+
+static void
+bench_panel(void *arg) {
+    const char *s = (const char *) arg;
+    int16_t w = gfx_getFont()->width * 2;
+    int16_t x = PANEL_X + (240 - 8 * w) / 2;
+
+    gfx_fillRoundRect(PANEL_X, PANEL_Y, 240, 32, 15, GFX_COLOR_BLUE);
+    gfx_drawRoundRect(PANEL_X, PANEL_Y, 240, 32, 15, GFX_COLOR_WHITE);
+    for (; *s; s++, x += w) {
+        gfx_drawChar(x, PANEL_Y + 4, (unsigned char) *s, GFX_COLOR_YELLOW,
+                     GFX_COLOR_BLUE, 2);
+    }
+}
+
+/* A string of transparent characters at size 2 */
+static void
+bench_label(int16_t x, int16_t y, const char *s, uint16_t color) {
+    for (; *s; s++, x += gfx_getFont()->width * 2) {
+        gfx_drawChar(x, y, (unsigned char) *s, color, color, 2);
+    }
+}
+
+/*
+ * The demo's screen: the title, four labelled boxes, the grey strip
+ * and the clock panel. The strip is in 9 steps rather than 135 lines
+ * and the multi-colored box is a plain one, so the whole screen fits
+ * in the default display list.
+ */
+static void
+bench_screen(void *arg) {
+    static const struct {
+        int16_t x, y;
+        uint16_t color;
+        const char *label;
+    } box[4] = {
+        { 20, 35, GFX_COLOR_RED, "RED" },
+        { 200, 35, GFX_COLOR_GREEN, "GREEN" },
+        { 200, 110, GFX_COLOR_BLUE, "BLUE" },
+        { 20, 110, GFX_COLOR_WHITE, "MULTI" },
+    };
+    int16_t w = gfx_getFont()->width * 2;
+    uint16_t g;
+    int i;
+
+    (void) arg;
+    bench_label((GFX_WIDTH - 17 * w) / 2, 0, "LCD Demonstration",
+                GFX_COLOR_WHITE);
+    for (i = 0; i < 4; i++) {
+        gfx_fillRoundRect(box[i].x, box[i].y, 100, 60, 10, box[i].color);
+        gfx_drawRoundRect(box[i].x, box[i].y, 100, 60, 10, GFX_COLOR_WHITE);
+        bench_label(box[i].x + 50 - w * (int16_t) strlen(box[i].label) / 2,
+                    box[i].y + 21, box[i].label,
+                    (i == 3) ? GFX_COLOR_BLACK : GFX_COLOR_WHITE);
+    }
+    for (i = 0; i < 9; i++) {
+        g = (uint16_t) (i * 255 / 8);
+        gfx_fillRect(135, 35 + i * 15, 50, 15, pixel_rgb(g, g, g));
+    }
+    gfx_drawRect(135, 35, 50, 135, GFX_COLOR_WHITE);
+    gfx_fillRoundRect(PANEL_X, 190, 240, 32, 15, GFX_COLOR_BLUE);
+    gfx_drawRoundRect(PANEL_X, 190, 240, 32, 15, GFX_COLOR_WHITE);
+    bench_label(PANEL_X + (240 - 8 * w) / 2, 194, "12:34:56",
+                GFX_COLOR_YELLOW);
+}
+
+/* The clock panel through the tile renderer, one frame */
+static void
+bench_panel_tiled(void *arg) {
+    gfx_tile_render(PANEL_X, PANEL_Y, 240, 32, BENCH_BG, bench_panel, arg);
+}
+
+/* The demo's screen through a display list, one frame */
+static void
+bench_screen_dl(void *arg) {
+    gfx_dl_begin(BENCH_BG);
+    bench_screen(arg);
+    gfx_dl_end();
+}
+
+/* Microseconds draw(arg) takes, run for at least BENCH_MIN_MS */
+static uint32_t
+bench_us(void (*draw)(void *), void *arg) {
+    uint32_t t, ms, n = 0;
+
+    t = mtime();
+    do {
+        draw(arg);
+        n++;
+        ms = mtime() - t;
+    } while (ms < BENCH_MIN_MS);
+    return (uint32_t) ((uint64_t) ms * 1000 / n);
+}
+
+/* Bus cycles so far, or 0 if there is nothing counting them */
+static uint32_t
+bench_bus(void) {
+#if defined(LCD_HOST)
+    struct lcd_emu_stats s;
+
+    lcd_emu_stats(&s, 0);
+    return s.cmd_writes + s.data_writes + s.reads;
+#elif defined(LCD_STATS)
+    struct lcd_bus_stats s;
+    uint32_t total = 0;
+    int i;
+
+    for (i = 0; i < LCD_STATS_SCOPES; i++) {
+        lcd_stats_get(i, &s);
+        total += s.cmd_writes + s.data_writes + s.reads;
+    }
+    return total;
+#else
+    return 0;
+#endif
+}
+
+/* Print v right justified in width columns */
+static void
+bench_col(uint32_t v, int width) {
+    char buf[12];
+    int i = sizeof(buf) - 1;
+
+    buf[i] = 0;
+    do {
+        buf[--i] = (char) (v % 10) + '0';
+        v /= 10;
+        width--;
+    } while (v && (i > 0));
+    while ((width-- > 0) && (i > 0)) {
+        buf[--i] = ' ';
+    }
+    uart_puts(&buf[i]);
+}
+
+/* Print s padded out to width columns */
+static void
+bench_name(const char *s, int width) {
+    uart_puts((char *) s);
+    while (*s++) {
+        width--;
+    }
+    while (width-- > 0) {
+        uart_puts(" ");
+    }
+}
+
+enum bench_kind {
+    B_CLEAR, B_RECTS, B_HLINES, B_VLINES, B_LINES, B_CIRCLES,
+    B_FILL_CIRCLES, B_TRIANGLES, B_FILL_TRIANGLES, B_ROUND_RECTS,
+    B_FILL_ROUND_RECTS, B_BITMAPS, B_DIGITS, B_TEXT1, B_TEXT2, B_TEXT3,
+    B_TEXT4, B_TEXT8, B_LABELS1, B_LABELS2, B_SMALL2,
+    B_AA1, B_AA2, B_CHART, B_CLIPPED, B_MESH, B_IMAGES, B_OPAQUE_BITMAPS,
+    B_PIXEL_TEXT2, B_PIXEL_TEXT4, B_PIXEL_TEXT8
+};
+
+struct bench {
+    const char *name;
+    uint8_t kind;
+    uint16_t count;
+};
+
+static const struct bench bench_suite[] = {
+    { "clear",              B_CLEAR,            20 },
+    { "fill_rect",          B_RECTS,            500 },
+    { "hline",              B_HLINES,           2000 },
+    { "vline",              B_VLINES,           2000 },
+    { "line",               B_LINES,            1000 },
+    { "circle",             B_CIRCLES,          500 },
+    { "fill_circle",        B_FILL_CIRCLES,     200 },
+    { "triangle",           B_TRIANGLES,        500 },
+    { "fill_triangle",      B_FILL_TRIANGLES,   200 },
+    { "round_rect",         B_ROUND_RECTS,      500 },
+    { "fill_round_rect",    B_FILL_ROUND_RECTS, 200 },
+    { "bitmap",             B_BITMAPS,          500 },
+    { "digits size 2",      B_DIGITS,           2000 },
+    { "text size 1",        B_TEXT1,            2000 },
+    { "text size 2",        B_TEXT2,            1000 },
+    { "text size 3",        B_TEXT3,            500 },
+    { "text size 4",        B_TEXT4,            500 },
+    { "text size 8",        B_TEXT8,            200 },
+    { "labels size 1",      B_LABELS1,          2000 },
+    { "labels size 2",      B_LABELS2,          1000 },
+    { "5x7 text size 2",    B_SMALL2,           1000 },
+    { "aa text size 1",     B_AA1,              2000 },
+    { "aa text size 2",     B_AA2,              1000 },
+    { "chart lines",        B_CHART,            2000 },
+    { "clipped circles",    B_CLIPPED,          500 },
+    { "triangle mesh",      B_MESH,             200 },
+    { "rgb image",          B_IMAGES,           500 },
+    { "opaque bitmap",      B_OPAQUE_BITMAPS,   500 },
+    { "text 2 per pixel",   B_PIXEL_TEXT2,      1000 },
+    { "text 4 per pixel",   B_PIXEL_TEXT4,      500 },
+    { "text 8 per pixel",   B_PIXEL_TEXT8,      200 },
+};
+
+#define BENCH_COUNT (sizeof(bench_suite) / sizeof(bench_suite[0]))
+
+static uint32_t
+bench_run(const struct bench *b) {
+    switch (b->kind) {
+    case B_CLEAR:
+        return bench_clear(b->count);
+    case B_RECTS:
+        return bench_rects(b->count);
+    case B_HLINES:
+        return bench_hlines(b->count);
+    case B_VLINES:
+        return bench_vlines(b->count);
+    case B_LINES:
+        return bench_lines(b->count);
+    case B_CIRCLES:
+        return bench_circles(b->count);
+    case B_FILL_CIRCLES:
+        return bench_fill_circles(b->count);
+    case B_TRIANGLES:
+        return bench_triangles(b->count, 0);
+    case B_FILL_TRIANGLES:
+        return bench_triangles(b->count, 1);
+    case B_ROUND_RECTS:
+        return bench_round_rects(b->count, 0);
+    case B_FILL_ROUND_RECTS:
+        return bench_round_rects(b->count, 1);
+    case B_BITMAPS:
+        return bench_bitmaps(b->count);
+    case B_DIGITS:
+        return bench_digits(b->count);
+    case B_TEXT8:
+        return bench_text(b->count, 8);
+    case B_PIXEL_TEXT2:
+        return bench_pixel_text(b->count, 2);
+    case B_PIXEL_TEXT4:
+        return bench_pixel_text(b->count, 4);
+    case B_PIXEL_TEXT8:
+        return bench_pixel_text(b->count, 8);
+    case B_LABELS1:
+        return bench_labels(b->count, 1);
+    case B_LABELS2:
+        return bench_labels(b->count, 2);
+    case B_SMALL2:
+        return bench_small_text(b->count, 2);
+    case B_AA1:
+        return bench_aa_text(b->count, 1);
+    case B_AA2:
+        return bench_aa_text(b->count, 2);
+    case B_CHART:
+        return bench_chart(b->count);
+    case B_CLIPPED:
+        return bench_clipped(b->count);
+    case B_MESH:
+        return bench_mesh(b->count);
+    case B_IMAGES:
+        return bench_images(b->count);
+    case B_OPAQUE_BITMAPS:
+        return bench_opaque_bitmaps(b->count);
+    default:
+        return bench_text(b->count, (uint8_t) (b->kind - B_TEXT1 + 1));
+    }
+}
+
+/*
+ * How much faster scaled text is a widened row at a time than a pixel
+ * at a time. The two are run turn about on the same characters until
+ * each has had BENCH_MIN_MS, so anything else slowing the machine down
+ * lands on both alike, and the speedup is the ratio of their times.
+ */
+#define SPEEDUP_CHARS   200
+
+static void
+bench_text_speedup(void) {
+    static const uint8_t sizes[] = { 2, 4, 8 };
+    uint32_t t, ms[2], x10;
+    unsigned int i;
+    int path;
+
+    uart_puts("scaled text speedup (rows vs per pixel):");
+    for (i = 0; i < sizeof(sizes); i++) {
+        ms[0] = ms[1] = 0;
+        do {
+            for (path = 0; path < 2; path++) {
+                bench_seed = sizes[i];
+                __gfx_state.charpixels = (uint8_t) path;
+                t = mtime();
+                bench_text(SPEEDUP_CHARS, sizes[i]);
+                ms[path] += mtime() - t;
+            }
+        } while ((ms[0] < BENCH_MIN_MS) || (ms[1] < BENCH_MIN_MS));
+        __gfx_state.charpixels = 0;
+        x10 = ms[1] * 10 / ms[0];
+        uart_puts(" size ");
+        bench_col(sizes[i], 0);
+        uart_puts(" ");
+        bench_col(x10 / 10, 0);
+        uart_puts(".");
+        bench_col(x10 % 10, 0);
+        uart_puts("x");
+    }
+    uart_puts("\n");
+}
+
+/*
+ * The clock panel rendered through the tile renderer at a few tile
+ * sizes: the RAM each needs, the tiles a frame is cut into, and the
+ * bus cycles and microseconds a frame costs. Sizes that don't fit the tile
+ * buffer (GFX_TILE_PIXELS) are left out. The first line is the panel
+ * drawn straight onto the screen, for comparison.
+ */
+#define TILE_FRAMES 100
+
+static const int16_t bench_tile_sizes[][2] = {
+    { 16, 16 }, { 32, 32 }, { 64, 32 }, { 64, 48 }, { 96, 32 }, { 240, 12 }
+};
+
+static void
+bench_tiles(void) {
+    struct gfx_tile_stats ts;
+    uint32_t bus;
+    unsigned int i, n;
+    int16_t w, h;
+
+    uart_puts("tile size     ram   tiles  bus/frame  us/frame\n");
+    gfx_fillScreen(BENCH_BG);
+    bus = bench_bus();
+    for (n = 0; n < TILE_FRAMES; n++) {
+        bench_panel("12:34:56");
+    }
+    bus = bench_bus() - bus;
+    uart_puts("direct          0       -");
+    if (bus) {
+        bench_col(bus / TILE_FRAMES, 11);
+    } else {
+        uart_puts("          -");
+    }
+    bench_col(bench_us(bench_panel, "12:34:56"), 10);
+    uart_puts("\n");
+    for (i = 0; i < sizeof(bench_tile_sizes) / sizeof(bench_tile_sizes[0]);
+         i++) {
+        w = bench_tile_sizes[i][0];
+        h = bench_tile_sizes[i][1];
+        if (gfx_tile_setsize(w, h) < 0) {
+            continue;
+        }
+        gfx_fillScreen(BENCH_BG);
+        gfx_tile_stats(NULL, 1);
+        bus = bench_bus();
+        for (n = 0; n < TILE_FRAMES; n++) {
+            bench_panel_tiled("12:34:56");
+        }
+        bus = bench_bus() - bus;
+        gfx_tile_stats(&ts, 1);
+
+        bench_col(w, 4);
+        uart_puts(" x");
+        bench_col(h, 4);
+        bench_col((uint32_t) w * h * sizeof(uint16_t), 8);
+        bench_col(ts.tiles / TILE_FRAMES, 8);
+        if (bus) {
+            bench_col(bus / TILE_FRAMES, 11);
+        } else {
+            uart_puts("          -");
+        }
+        bench_col(bench_us(bench_panel_tiled, "12:34:56"), 10);
+        uart_puts("\n");
+    }
+    gfx_tile_setsize(64, 48);   /* back to the default */
+}
+
+/*
+ * The demo's screen recorded into a display list and rendered a tile
+ * at a time, against drawing it straight onto the panel: the size of
+ * the list, the bus cycles and microseconds a frame costs each way,
+ * and how many commands each of the display list's tiles replayed.
+ */
+#define DL_FRAMES   20
+
+static void
+bench_dl(void) {
+    struct gfx_dl_stats ds;
+    uint32_t bus;
+    unsigned int n;
+    int tx, ty;
+
+    gfx_fillScreen(BENCH_BG);
+    bus = bench_bus();
+    for (n = 0; n < DL_FRAMES; n++) {
+        bench_screen(NULL);
+    }
+    bus = bench_bus() - bus;
+    uart_puts("demo screen direct       bus/frame");
+    bench_col(bus / DL_FRAMES, 9);
+    uart_puts(" us/frame");
+    bench_col(bench_us(bench_screen, NULL), 7);
+    uart_puts("\n");
+
+    gfx_fillScreen(BENCH_BG);
+    gfx_dl_stats(NULL, 1);
+    bus = bench_bus();
+    for (n = 0; n < DL_FRAMES; n++) {
+        bench_screen_dl(NULL);
+    }
+    bus = bench_bus() - bus;
+    gfx_dl_stats(&ds, 0);
+    uart_puts("demo screen display list bus/frame");
+    bench_col(bus / DL_FRAMES, 9);
+    uart_puts(" us/frame");
+    bench_col(bench_us(bench_screen_dl, NULL), 7);
+    uart_puts("\n");
+    uart_puts("  commands ");
+    bench_col(ds.cmds, 0);
+    uart_puts(" bytes ");
+    bench_col(ds.bytes, 0);
+    uart_puts(" (peak ");
+    bench_col(ds.peak_bytes, 0);
+    uart_puts(") overflows ");
+    bench_col(ds.overflows, 0);
+    uart_puts("\n  commands per tile\n");
+    for (ty = 0; ty < ds.tiles_y; ty++) {
+        uart_puts("   ");
+        for (tx = 0; tx < ds.tiles_x; tx++) {
+            bench_col(ds.tile_cmds[ty * ds.tiles_x + tx], 4);
+        }
+        uart_puts("\n");
+    }
+}
+
+int
+main(void) {
+    unsigned int i;
+    uint32_t t, px, bus, ms, passes, prims;
+    uint32_t total_ms = 0;
+    struct gfx_glyph_stats glyphs, g;
+
+    clock_setup();
+    systick_setup();
+    uart_setup(115200);
+
+    uart_puts("\nLCD Bench 0.1\n");
+    lcd_setup();
+    lcd_init();
+    gfx_init();
+
+    uart_puts("workload           prims      ms   prims/s      px/s  bus/prim\n");
+    gfx_glyph_stats(&glyphs, 1);
+    glyphs.hits = glyphs.misses = glyphs.evictions = 0;
+    for (i = 0; i < BENCH_COUNT; i++) {
+        gfx_fillScreen(BENCH_BG);
+        bus = bench_bus();
+        px = 0;
+        passes = 0;
+        t = mtime();
+        do {
+            bench_seed = i + 1;
+            PROF_BEGIN(workload);
+            px += bench_run(&bench_suite[i]);
+            PROF_END(workload);
+            if (passes++ == 0) {
+                bus = bench_bus() - bus;
+                gfx_glyph_stats(&g, 1);
+                glyphs.hits += g.hits;
+                glyphs.misses += g.misses;
+                glyphs.evictions += g.evictions;
+            }
+            ms = mtime() - t;
+        } while (ms < BENCH_MIN_MS);
+        gfx_glyph_stats(NULL, 1);
+        total_ms += ms;
+        prims = (uint32_t) bench_suite[i].count * passes;
+
+        bench_name(bench_suite[i].name, 16);
+        bench_col(prims, 8);
+        bench_col(ms, 8);
+        bench_col((uint32_t) ((uint64_t) prims * 1000 / ms), 10);
+        bench_col((uint32_t) ((uint64_t) px * 1000 / ms), 10);
+        if (bus) {
+            bench_col(bus / bench_suite[i].count, 10);
+        } else {
+            uart_puts("         -");
+        }
+        uart_puts("\n");
+    }
+    uart_puts("total ms ");
+    bench_col(total_ms, 0);
+    uart_puts("\n");
+    bench_text_speedup();
+    uart_puts("glyph cache hits ");
+    bench_col(glyphs.hits, 0);
+    uart_puts(" misses ");
+    bench_col(glyphs.misses, 0);
+    uart_puts(" evictions ");
+    bench_col(glyphs.evictions, 0);
+    uart_puts("\n");
+    bench_tiles();
+    bench_dl();
+#ifdef LCD_STATS
+    gfx_stats_dump();
+#endif
+    prof_dump();
+#if LCD_SHADOW && defined(LCD_SHADOW_CHECK)
+    uart_puts("register shadow errors ");
+    bench_col(lcd_shadow_errors(), 0);
+    uart_puts("\n");
+#endif
+#ifdef LCD_HOST
+    return 0;
+#else
+    while (1) {
+        msleep(1000);
+    }
+#endif
+}
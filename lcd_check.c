@@ -0,0 +1,471 @@
+/*
+ * Copyright (C) 2013 Chuck McManis (cmcmanis@mcmanis.com)
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ */
+
+/*
+ * lcd_check.c - host checks for the LCD driver
+ *
+ * Drives lcd.c and lcd_dma.c against the SSD2119 model (lcd_emu.c)
+ * and compares what ends up in GRAM with what should have. Host only,
+ * "make -f Makefile.host check" builds and runs it. Each check prints
+ * a line, the program exits non zero if any of them failed.
+ *
+ * dma queue: more transfers than LCD_DMA_QUEUE_LEN are queued at once,
+ * writes and fills mixed, one of them a full screen fill that has to
+ * be split into LCD_DMA_MAX_CHUNK pieces and one queued by another's
+ * callback. The callbacks have to run once each and in order, and
+ * the panel has to match a picture drawn by hand, in every rotation.
+ * A callback that queues more than there is room for has to be told
+ * no rather than wait forever, and the scan direction the caller had
+ * has to be back once the queue is empty.
+ *
+ * background: lcd_set_background() has to paint every pixel in every
+ * rotation, and lcd_rgb_test() has to put the same pattern in GRAM
+ * whatever the rotation and leave the rotation as it found it.
+ *
+ * register shadow: a long run of random driver calls (windows, pixels,
+ * bursts, raw register and GRAM writes, GRAM reads, entry modes, scan
+ * directions, rotations and DMA) with lcd.c built with LCD_SHADOW_CHECK,
+ * so the shadow is compared with the model after every access. Any
+ * difference at all fails it. Then lines, pixels and windows in both
+ * scan directions, with ENTRY_MODE written behind the driver's back,
+ * have to leave GRAM as drawn by hand.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include "lcd.h"
+#include "lcd_emu.h"
+#include "lcd_dma.h"
+
+#define CHECK_W     320
+#define CHECK_H     240
+
+/* what the panel should show, in screen (rotated) coordinates */
+static uint16_t check_ref[CHECK_W * CHECK_H];
+static int check_failed;
+
+static uint32_t check_seed = 1;
+
+static uint16_t
+check_rand(uint16_t range) {
+    check_seed = check_seed * 1103515245 + 12345;
+    return (uint16_t) ((check_seed >> 16) % range);
+}
+
+static void
+check_result(const char *name, int bad) {
+    printf("%-24s %s", name, bad ? "FAILED" : "ok");
+    if (bad) {
+        printf(" (%d)", bad);
+        check_failed++;
+    }
+    printf("\n");
+}
+
+/* The GRAM pixel that screen pixel x, y lands on at rotation rot */
+static uint16_t
+check_pixel(int rot, uint16_t x, uint16_t y) {
+    switch (rot) {
+        case 1:
+            return lcd_emu_pixel(CHECK_W - 1 - y, x);
+        case 2:
+            return lcd_emu_pixel(CHECK_W - 1 - x, CHECK_H - 1 - y);
+        case 3:
+            return lcd_emu_pixel(y, CHECK_H - 1 - x);
+        default:
+            return lcd_emu_pixel(x, y);
+    }
+}
+
+/* Pixels that differ from check_ref */
+static int
+check_screen(int rot) {
+    uint16_t w = lcd_width(), h = lcd_height(), x, y;
+    int bad = 0;
+
+    for (y = 0; y < h; y++) {
+        for (x = 0; x < w; x++) {
+            if (check_pixel(rot, x, y) != check_ref[y * w + x]) {
+                bad++;
+            }
+        }
+    }
+    return bad;
+}
+
+/* Draw a window into check_ref the way the panel should */
+static void
+check_draw(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+           const uint16_t *src, uint16_t color) {
+    uint16_t w = lcd_width(), x, y;
+
+    for (y = y0; y <= y1; y++) {
+        for (x = x0; x <= x1; x++) {
+            check_ref[y * w + x] = (src) ? *src++ : color;
+        }
+    }
+}
+
+#define DMA_XFERS   (LCD_DMA_QUEUE_LEN + 5)
+#define DMA_CHAIN   5   /* the one whose callback queues another */
+
+static struct {
+    uint16_t x0, y0, x1, y1, color;
+    const uint16_t *src;
+} dma_xfer[DMA_XFERS + 1];
+static uint16_t dma_buf[DMA_XFERS][40 * 30];
+static uint8_t dma_order[DMA_XFERS + 1];
+static int dma_calls;
+
+static void
+dma_done(void *arg) {
+    if (dma_calls <= DMA_XFERS) {
+        dma_order[dma_calls] = (uint8_t) (uintptr_t) arg;
+    }
+    dma_calls++;
+}
+
+/* queued from inside a callback, while the engine is running */
+static void
+dma_chain(void *arg) {
+    dma_done(arg);
+    lcd_dma_fill(0, 0, 9, 9, 0xf81f, dma_done, (void *) DMA_XFERS);
+}
+
+static void
+check_dma(void) {
+    struct lcd_emu_stats s;
+    uint16_t x0, y0;
+    uint32_t k, n;
+    int rot, i, bad = 0, chained;
+
+    dma_xfer[DMA_XFERS].x1 = dma_xfer[DMA_XFERS].y1 = 9;
+    dma_xfer[DMA_XFERS].color = 0xf81f;
+    for (rot = 0; rot < 4; rot++) {
+        lcd_set_rotation(rot);
+        lcd_dma_init(NULL);
+        lcd_emu_stats(NULL, 1);
+        dma_calls = 0;
+
+        /* the first is the whole screen, more than one chunk */
+        dma_xfer[0].x1 = lcd_width() - 1;
+        dma_xfer[0].y1 = lcd_height() - 1;
+        dma_xfer[0].color = 0x1234;
+        for (i = 1; i < DMA_XFERS; i++) {
+            x0 = check_rand(lcd_width() - 40);
+            y0 = check_rand(lcd_height() - 30);
+            dma_xfer[i].x0 = x0;
+            dma_xfer[i].y0 = y0;
+            dma_xfer[i].x1 = x0 + check_rand(40);
+            dma_xfer[i].y1 = y0 + check_rand(30);
+            dma_xfer[i].color = check_rand(65535);
+            dma_xfer[i].src = NULL;
+            if (i & 1) {
+                n = (uint32_t) (dma_xfer[i].x1 - x0 + 1) *
+                    (dma_xfer[i].y1 - y0 + 1);
+                for (k = 0; k < n; k++) {
+                    dma_buf[i][k] = check_rand(65535);
+                }
+                dma_xfer[i].src = dma_buf[i];
+            }
+        }
+        for (i = 0; i < DMA_XFERS; i++) {
+            if (dma_xfer[i].src) {
+                lcd_dma_write(dma_xfer[i].x0, dma_xfer[i].y0, dma_xfer[i].x1,
+                              dma_xfer[i].y1, dma_xfer[i].src,
+                              (i == DMA_CHAIN) ? dma_chain : dma_done,
+                              (void *) (uintptr_t) i);
+            } else {
+                lcd_dma_fill(dma_xfer[i].x0, dma_xfer[i].y0, dma_xfer[i].x1,
+                             dma_xfer[i].y1, dma_xfer[i].color,
+                             (i == DMA_CHAIN) ? dma_chain : dma_done,
+                             (void *) (uintptr_t) i);
+            }
+        }
+        lcd_dma_wait();
+
+        /*
+         * Every callback once, the queued ones in order and the chained
+         * one after the one that queued it. Where it falls among the
+         * rest depends on when the queue was full, so the picture is
+         * drawn in the order they actually finished.
+         */
+        if (dma_calls != DMA_XFERS + 1) {
+            bad++;
+        }
+        for (i = 0, k = 0, chained = 0; i < dma_calls; i++) {
+            if (dma_order[i] == DMA_XFERS) {
+                chained = 1;
+                if (k <= DMA_CHAIN) {
+                    bad++;
+                }
+            } else if (dma_order[i] != k++) {
+                bad++;
+            }
+            check_draw(dma_xfer[dma_order[i]].x0, dma_xfer[dma_order[i]].y0,
+                       dma_xfer[dma_order[i]].x1, dma_xfer[dma_order[i]].y1,
+                       dma_xfer[dma_order[i]].src,
+                       dma_xfer[dma_order[i]].color);
+        }
+        if (! chained) {
+            bad++;
+        }
+        bad += check_screen(rot);
+        lcd_emu_stats(&s, 0);
+        bad += s.outside;
+
+        /* and the driver has to know where the counter was left */
+        lcd_write_pixel(1, 1, 0x0f0f);
+        check_ref[lcd_width() + 1] = 0x0f0f;
+        bad += check_screen(rot);
+    }
+    lcd_set_rotation(0);
+    check_result("dma queue", bad);
+}
+
+static void
+check_background(void) {
+    uint16_t x, y;
+    int rot, bad = 0;
+
+    /* the pattern doesn't reach the bottom lines, so clear them first */
+    lcd_set_rotation(0);
+    lcd_set_background(0, 0, 0);
+    lcd_rgb_test();
+    for (y = 0; y < CHECK_H; y++) {
+        for (x = 0; x < CHECK_W; x++) {
+            check_ref[y * CHECK_W + x] = lcd_emu_pixel(x, y);
+        }
+    }
+    for (rot = 0; rot < 4; rot++) {
+        lcd_set_rotation(rot);
+        lcd_set_background(0xff, 0xff, 0xff);
+        for (y = 0; y < CHECK_H; y++) {
+            for (x = 0; x < CHECK_W; x++) {
+                bad += (lcd_emu_pixel(x, y) != 0xffff);
+            }
+        }
+        lcd_set_background(0, 0, 0);
+        lcd_rgb_test();
+        bad += (lcd_width() != ((rot & 1) ? CHECK_H : CHECK_W));
+        for (y = 0; y < CHECK_H; y++) {
+            for (x = 0; x < CHECK_W; x++) {
+                bad += (lcd_emu_pixel(x, y) != check_ref[y * CHECK_W + x]);
+            }
+        }
+    }
+    lcd_set_rotation(0);
+    check_result("background", bad);
+}
+
+#define SHADOW_OPS  200000
+#define GRAM_OPS    300
+
+/*
+ * After the random run: lines, pixels and windows streamed in either
+ * scan direction, with ENTRY_MODE scribbled on in between the way the
+ * run does it, have to leave GRAM as drawn by hand. A driver that
+ * trusts a stale scan direction passes the register comparison but
+ * not this.
+ */
+static int
+check_gram(void) {
+    uint16_t x0, y0, x1, y1, w, h, x, y, c;
+    const uint16_t *src;
+    int rot, bad = 0, dir;
+    uint32_t k;
+
+    for (rot = 0; rot < 4; rot++) {
+        lcd_set_rotation(rot);
+        w = lcd_width();
+        h = lcd_height();
+        lcd_set_background(0, 0, 0);
+        check_draw(0, 0, w - 1, h - 1, NULL, 0);
+        for (k = 0; k < GRAM_OPS; k++) {
+            if (check_rand(4) == 0) {
+                lcd_writereg(ENTRY_MODE, 0x6800 | (check_rand(8) << 3));
+            }
+            x0 = check_rand(w);
+            y0 = check_rand(h);
+            c = check_rand(65535);
+            dir = check_rand(2) ? LCD_SCAN_V : LCD_SCAN_H;
+            switch (check_rand(3)) {
+                case 0:
+                    if (dir == LCD_SCAN_V) {
+                        y1 = y0 + check_rand(h - y0);
+                        lcd_fill_line(x0, y0, y1 - y0 + 1, dir, c);
+                        check_draw(x0, y0, x0, y1, NULL, c);
+                    } else {
+                        x1 = x0 + check_rand(w - x0);
+                        lcd_fill_line(x0, y0, x1 - x0 + 1, dir, c);
+                        check_draw(x0, y0, x1, y0, NULL, c);
+                    }
+                    break;
+                case 1:
+                    lcd_write_pixel(x0, y0, c);
+                    check_draw(x0, y0, x0, y0, NULL, c);
+                    break;
+                default:
+                    x0 = check_rand(w - 30);
+                    y0 = check_rand(h - 30);
+                    x1 = x0 + check_rand(30);
+                    y1 = y0 + check_rand(30);
+                    lcd_set_scan(dir);
+                    lcd_set_window(x0, y0, x1, y1);
+                    lcd_write_pixels(dma_buf[0],
+                                     (uint32_t) (x1 - x0 + 1) * (y1 - y0 + 1));
+                    if (dir == LCD_SCAN_H) {
+                        check_draw(x0, y0, x1, y1, dma_buf[0], 0);
+                        break;
+                    }
+                    for (x = x0, src = dma_buf[0]; x <= x1; x++) {
+                        for (y = y0; y <= y1; y++) {
+                            check_ref[y * w + x] = *src++;
+                        }
+                    }
+                    break;
+            }
+        }
+        bad += check_screen(rot);
+    }
+    lcd_set_rotation(0);
+    lcd_set_scan(LCD_SCAN_H);
+    return bad;
+}
+
+static void
+check_shadow(void) {
+    uint16_t x0, y0, w, h;
+    uint32_t k;
+
+    for (k = 0; k < 1000; k++) {
+        dma_buf[0][k] = check_rand(65535);
+    }
+    for (k = 0; k < SHADOW_OPS; k++) {
+        w = lcd_width();
+        h = lcd_height();
+        x0 = check_rand(w);
+        y0 = check_rand(h);
+        switch (check_rand(11)) {
+            case 0:
+                lcd_set_window(x0, y0, x0 + check_rand(w - x0),
+                               y0 + check_rand(h - y0));
+                break;
+            case 1:
+                lcd_fill_pixels(check_rand(65535), check_rand(2000));
+                break;
+            case 2:
+                lcd_write_pixels(dma_buf[0], check_rand(1000));
+                break;
+            case 3:
+                lcd_writereg(ENTRY_MODE, 0x6800 | (check_rand(8) << 3));
+                break;
+            case 4:
+                lcd_write_pixel(x0, y0, check_rand(65535));
+                break;
+            case 5:
+                lcd_writereg(RAM_DATA, check_rand(65535));
+                break;
+            case 6:
+                if (check_rand(4) == 0) {
+                    (void) lcd_readreg(RAM_DATA);
+                } else if (check_rand(2)) {
+                    lcd_writereg(X_RAM_ADDR, check_rand(CHECK_W));
+                } else {
+                    lcd_writereg(Y_RAM_ADDR, check_rand(CHECK_H));
+                }
+                break;
+            case 7:
+                lcd_set_scan(check_rand(2) ? LCD_SCAN_V : LCD_SCAN_H);
+                break;
+            case 8:
+                if (check_rand(50) == 0) {
+                    lcd_set_rotation(check_rand(4));
+                }
+                break;
+            case 9:
+                if (check_rand(10) == 0) {
+                    x0 = check_rand(w - 20);
+                    y0 = check_rand(h - 40);
+                    if (check_rand(2)) {
+                        lcd_dma_fill(x0, y0, x0 + check_rand(20),
+                                     y0 + check_rand(40), check_rand(65535),
+                                     NULL, NULL);
+                    } else {
+                        lcd_dma_write(x0, y0, x0 + check_rand(20),
+                                      y0 + check_rand(40), dma_buf[0],
+                                      NULL, NULL);
+                    }
+                    lcd_dma_wait();
+                }
+                break;
+            default:
+                if (check_rand(2)) {
+                    lcd_fill_line(x0, y0, check_rand(h - y0) + 1, LCD_SCAN_V,
+                                  check_rand(65535));
+                } else {
+                    lcd_fill_line(x0, y0, check_rand(w - x0) + 1, LCD_SCAN_H,
+                                  check_rand(65535));
+                }
+                break;
+        }
+    }
+    /* one more access, so the last DMA transfer is compared too */
+    lcd_write_pixel(0, 0, 0);
+    check_result("gram after random run", check_gram());
+#if LCD_SHADOW
+    check_result("register shadow", (int) lcd_shadow_errors());
+#else
+    printf("%-24s skipped (LCD_SHADOW=0)\n", "register shadow");
+#endif
+}
+
+static int dma_refused;
+
+/* tries to queue two more with only one free slot */
+static void
+dma_greedy(void *arg) {
+    (void) arg;
+    dma_refused += (lcd_dma_fill(0, 0, 3, 3, 0x07e0, NULL, NULL) != 0);
+    dma_refused += (lcd_dma_fill(0, 0, 3, 3, 0x07e0, NULL, NULL) != 0) * 2;
+}
+
+static void
+check_dma_done(void) {
+    int i, bad = 0;
+
+    lcd_dma_init(NULL);
+    lcd_set_scan(LCD_SCAN_V);
+    dma_refused = 0;
+    for (i = 0; i < LCD_DMA_QUEUE_LEN; i++) {
+        lcd_dma_fill(0, 0, 9, 9, 0x001f, (i == 0) ? dma_greedy : NULL, NULL);
+    }
+    lcd_dma_wait();
+    if (dma_refused != 2) {
+        bad++;
+    }
+    if ((lcd_scan() != LCD_SCAN_V) ||
+        ! (lcd_emu_reg(ENTRY_MODE) & LCD_ENTRY_AM)) {
+        bad++;
+    }
+    lcd_set_scan(LCD_SCAN_H);
+    check_result("dma callbacks and scan", bad);
+}
+
+int
+main(void) {
+    lcd_setup();
+    lcd_init();
+    check_dma();
+    check_dma_done();
+    check_background();
+    check_shadow();
+    return check_failed ? 1 : 0;
+}
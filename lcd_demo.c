@@ -1,15 +1,31 @@
 /* LCD functions */
 
 #include <stdint.h>
+#include <stddef.h>
+#ifdef LCD_HOST
+#include "lcd_emu.h"
+#else
 #include <libopencm3/cm3/assert.h>
 #include <libopencm3/stm32/f4/rcc.h>
 #include <libopencm3/stm32/f4/gpio.h>
 #include <libopencm3/cm3/nvic.h>
 #include <libopencm3/cm3/systick.h>
+#endif
 #include "lcd.h"
 #include "util.h"
 #include "gfx.h"
 
+/*
+ * On the host (make -f Makefile.host) there is no panel to look at, so
+ * each screen is saved as a picture instead and the demo stops after
+ * the boxes have gone round once.
+ */
+#ifdef LCD_HOST
+#define SNAPSHOT(file)  lcd_emu_dump_ppm(file)
+#else
+#define SNAPSHOT(file)
+#endif
+
 int configure_fsmc(char *, int);
 
 volatile uint16_t *test_ptr = (uint16_t *)(0x60000000);
@@ -17,6 +33,29 @@ volatile uint16_t dummy_data;
 
 int show_time(void);
 void fill_box(uint16_t, uint16_t, int);
+void draw_time(void *);
+void draw_screen(void *);
+
+/* where the clock digits go */
+#define TIME_X  (40 + (240 - 16*12)/2)
+#define TIME_Y  (190 + (32 - 18)/2)
+
+/* what is on the screen right now */
+static uint16_t demo_toggle;
+static struct gfx_text demo_clock;
+
+/*
+ * draw_time()
+ *
+ * The clock panel itself, this is called by the tile renderer for
+ * each piece of the panel so it has to draw the whole thing each time.
+ */
+void
+draw_time(void *arg) {
+    gfx_fillRoundRect(40, 190, 240, 32, 15, GFX_COLOR_BLUE);
+    gfx_drawRoundRect(40, 190, 240, 32, 15, GFX_COLOR_WHITE);
+    gfx_text_draw((struct gfx_text *) arg);
+}
 
 /*
  * show_time()
@@ -26,6 +65,9 @@ void fill_box(uint16_t, uint16_t, int);
  * this code takes that, and create a 'time' out of it in the
  * form of an elapsed time counter for hours, minutes, seconds
  * and fractions of a second. 
+ *
+ * The digits are a text field, opaque on the panel's blue, so only
+ * the characters that changed are redrawn, straight over the old ones.
  */
 int
 show_time() {
@@ -61,11 +103,8 @@ show_time() {
     i = t % 24;
     timestring[1] = (char)(i % 10) + '0';
     timestring[0] = (char)((i/10) % 10) + '0';
-    gfx_fillRoundRect(40, 190, 240, 32, 15, GFX_COLOR_BLUE);
-    gfx_drawRoundRect(40, 190, 240, 32, 15, GFX_COLOR_WHITE);
-    gfx_setCursor(40 + (240 - 16*12)/2, 190 + (32 - 18)/2);
-    gfx_setTextColor(GFX_COLOR_YELLOW, GFX_COLOR_YELLOW);
-    gfx_puts(timestring);
+
+    gfx_text_update(&demo_clock, timestring);
     return res;
 }
 
@@ -149,11 +188,31 @@ show_grey() {
     gfx_drawRect(135, 35, 50, 135, GFX_COLOR_WHITE);
 }
 
+/*
+ * draw_screen
+ *
+ * Everything on the demo screen. This is what the damage flush uses to
+ * repaint the areas that changed, it only ever draws into a tile so
+ * drawing the lot each time costs next to nothing on the bus.
+ */
+void
+draw_screen(void *arg) {
+    (void) arg;
+    gfx_setTextColor(GFX_COLOR_WHITE, GFX_COLOR_WHITE);
+    gfx_setTextSize(2);
+    gfx_setCursor((320 - 17*16)/2, 0);
+    gfx_puts("LCD Demonstration");
+    fill_box(20, 35, demo_toggle & 0x3);
+    fill_box(200, 35, (demo_toggle + 1) & 0x3);
+    fill_box(200, 110, (demo_toggle + 2) & 0x3);
+    fill_box(20, 110, (demo_toggle + 3) & 0x3);
+    show_grey();
+    draw_time(&demo_clock);
+}
+
 int
 main(void) {
     /* configure FSMC for bank 4 static RAM */
-    uint16_t toggle = 0;
-
     clock_setup();
     systick_setup();
     uart_setup(115200);
@@ -172,33 +231,41 @@ main(void) {
     gfx_puts("LCD Test demo\nTesting lower case.\n switching in 5 seconds");
     uart_puts("Done [LCD Init]\n");
     uart_puts(" Next step in 5 seconds ... Screen should GREEN\n");
+    SNAPSHOT("lcd_demo-1.ppm");
     msleep(5000);
     lcd_rgb_test();
     uart_puts(" Next step in 5 seconds, screen should be MULTICOLORED\n");
+    SNAPSHOT("lcd_demo-2.ppm");
     msleep(5000);
 
-    gfx_setTextColor(GFX_COLOR_WHITE, GFX_COLOR_WHITE);
     lcd_set_background(0x0, 0, 0x0);
-    gfx_setTextSize(2);
-    gfx_setCursor((320 - 17*16)/2, 0);
-    gfx_puts("LCD Demonstration");
+    gfx_text_init(&demo_clock, TIME_X, TIME_Y, 2, GFX_COLOR_YELLOW,
+                  GFX_COLOR_BLUE);
+    gfx_damage_add(0, 0, gfx_width(), gfx_height());
 
 /* box is 100 x 60, screen is 320 wide, so in the left side is 
  * x=30, y = 15, y= 80, and the right side, x = 190, y = 15, y = 80
  */
     while (1) {
         int blip = 0;
-        fill_box(20, 35, toggle & 0x3);
-        fill_box(200, 35, (toggle + 1) & 0x3);
-        fill_box(200, 110, (toggle + 2) & 0x3);
-        fill_box(20, 110, (toggle + 3) & 0x3);
-        show_grey();
+        /* the boxes change every time round, nothing else does */
+        gfx_damage_add(20, 35, 100, 60);
+        gfx_damage_add(200, 35, 100, 60);
+        gfx_damage_add(200, 110, 100, 60);
+        gfx_damage_add(20, 110, 100, 60);
+        gfx_damage_flush(GFX_COLOR_BLACK, draw_screen, NULL);
         uart_puts("Type space to continue ...\n");
         while ((uart_getc(0) != ' ') && ! blip) {
             blip = show_time();
             msleep(100);
         }
-        toggle++;
+        demo_toggle++;
+#ifdef LCD_HOST
+        if (demo_toggle == 4) {
+            SNAPSHOT("lcd_demo-3.ppm");
+            return 0;
+        }
+#endif
     }
 }
 
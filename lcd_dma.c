@@ -0,0 +1,312 @@
+/*
+ * Copyright (C) 2013 Chuck McManis (cmcmanis@mcmanis.com)
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ */
+
+/*
+ * lcd_dma.c - push pixels at the LCD without the CPU
+ *
+ * Filling the whole panel from the CPU keeps it busy for the entire
+ * frame. Since the LCD data port is just a memory address (see lcd.c)
+ * the DMA2 controller can do the copying in memory to memory mode
+ * while the CPU gets on with something else: the "peripheral" side
+ * of the stream is the pixel source (stepping through a buffer, or
+ * sitting on one color for a fill) and the "memory" side is the FSMC
+ * data address, which never moves.
+ *
+ * Transfers are queued. Each one carries its own GRAM window, which is
+ * set up (by the CPU, from the completion interrupt) just before its
+ * data starts flowing, and an optional callback that runs when it is
+ * done. While anything is queued the LCD belongs to the engine, so
+ * call lcd_dma_wait() before going back to lcd_writereg() and friends.
+ * Transfers always go in LCD_SCAN_H order; the scan direction the
+ * caller had is put back when the queue runs empty.
+ *
+ * The DMA controller itself is behind struct lcd_dma_backend, the
+ * board uses lcd_stm32_dma below and the host build uses the simulated
+ * one in lcd_emu.c, which is how the queueing is exercised off target.
+ */
+
+#include <stdint.h>
+#ifndef LCD_HOST
+#include <libopencm3/stm32/rcc.h>
+#include <libopencm3/stm32/dma.h>
+#include <libopencm3/cm3/nvic.h>
+#endif
+#include "lcd.h"
+#include "lcd_dma.h"
+
+#ifdef LCD_HOST
+#define LCD_DMA_LOCK()
+#define LCD_DMA_UNLOCK()
+#else
+#define LCD_DMA_LOCK()      nvic_disable_irq(NVIC_DMA2_STREAM0_IRQ)
+#define LCD_DMA_UNLOCK()    nvic_enable_irq(NVIC_DMA2_STREAM0_IRQ)
+#endif
+
+struct lcd_dma_xfer {
+    uint16_t            x0, y0, x1, y1;
+    const uint16_t      *src;       /* NULL for a fill */
+    uint32_t            count;
+    uint16_t            color;
+    lcd_dma_callback    callback;
+    void                *arg;
+};
+
+static struct lcd_dma_xfer dma_queue[LCD_DMA_QUEUE_LEN];
+static volatile uint8_t dma_head;
+static volatile uint8_t dma_queued;
+static volatile uint8_t dma_active;
+static volatile uint8_t dma_in_done;    /* running a callback */
+static int dma_scan;                    /* the caller's lcd_scan() */
+
+/* progress through the transfer at the head of the queue */
+static const uint16_t *dma_cur;
+static uint32_t dma_remaining;
+
+static const struct lcd_dma_backend *dma_backend;
+
+/* Hand the next piece (at most LCD_DMA_MAX_CHUNK) to the controller */
+static void
+dma_chunk(void) {
+    uint16_t n;
+    int inc = (dma_queue[dma_head].src != 0);
+
+    n = (dma_remaining > LCD_DMA_MAX_CHUNK) ? LCD_DMA_MAX_CHUNK :
+                                              (uint16_t) dma_remaining;
+    dma_remaining -= n;
+    lcd_gram_written(n);
+    dma_backend->start(dma_cur, n, inc);
+    if (inc) {
+        dma_cur += n;
+    }
+}
+
+/* Start the transfer at the head of the queue, if there is one */
+static void
+dma_next(void) {
+    struct lcd_dma_xfer *x;
+
+    if (dma_queued == 0) {
+        return;
+    }
+    x = &dma_queue[dma_head];
+    dma_active = 1;
+    lcd_set_scan(LCD_SCAN_H);
+    lcd_set_window(x->x0, x->y0, x->x1, x->y1);
+    lcd_write_pixels(x->src, 0);    /* select RAM_DATA, no data yet */
+    dma_cur = (x->src) ? x->src : &x->color;
+    dma_remaining = x->count;
+    dma_chunk();
+}
+
+/*
+ * lcd_dma_done()
+ *
+ * Called by the backend (from the transfer complete interrupt on the
+ * board) each time a chunk finishes.
+ */
+void
+lcd_dma_done(void) {
+    lcd_dma_callback cb;
+    void *arg;
+
+    if (dma_remaining) {
+        dma_chunk();
+        return;
+    }
+    cb = dma_queue[dma_head].callback;
+    arg = dma_queue[dma_head].arg;
+    dma_head = (dma_head + 1) % LCD_DMA_QUEUE_LEN;
+    dma_queued--;
+    dma_active = 0;
+    if (dma_queued == 0) {
+        lcd_set_scan(dma_scan);
+    }
+    if (cb) {
+        dma_in_done = 1;
+        cb(arg);
+        dma_in_done = 0;
+    }
+    /* the callback may have queued (and started) something itself */
+    if (! dma_active) {
+        dma_next();
+    }
+}
+
+/*
+ * Add a transfer to the tail of the queue, waiting for room if need be.
+ * A callback can't wait (on the board it is the interrupt that would
+ * make room), so from there a full queue is an error.
+ */
+static int
+dma_queue_xfer(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+               const uint16_t *src, uint16_t color,
+               lcd_dma_callback cb, void *arg) {
+    struct lcd_dma_xfer *x;
+
+    if (x1 >= lcd_width()) {
+        x1 = lcd_width() - 1;
+    }
+    if (y1 >= lcd_height()) {
+        y1 = lcd_height() - 1;
+    }
+    if ((x0 > x1) || (y0 > y1)) {
+        return -1;
+    }
+    while (dma_queued == LCD_DMA_QUEUE_LEN) {
+        if (dma_in_done) {
+            return -1;
+        }
+        if (dma_backend->poll) {
+            dma_backend->poll();
+        }
+    }
+
+    LCD_DMA_LOCK();
+    if ((dma_queued == 0) && ! dma_active) {
+        dma_scan = lcd_scan();
+    }
+    x = &dma_queue[(dma_head + dma_queued) % LCD_DMA_QUEUE_LEN];
+    x->x0 = x0;
+    x->y0 = y0;
+    x->x1 = x1;
+    x->y1 = y1;
+    x->src = src;
+    x->color = color;
+    x->count = (uint32_t) (x1 - x0 + 1) * (y1 - y0 + 1);
+    x->callback = cb;
+    x->arg = arg;
+    dma_queued++;
+    if (! dma_active) {
+        dma_next();
+    }
+    LCD_DMA_UNLOCK();
+    return 0;
+}
+
+/*
+ * lcd_dma_init(backend)
+ *
+ * Pick the DMA controller to use, NULL means the one for this build.
+ */
+void
+lcd_dma_init(const struct lcd_dma_backend *backend) {
+    if (backend == 0) {
+#ifdef LCD_HOST
+        backend = &lcd_emu_dma;
+#else
+        backend = &lcd_stm32_dma;
+#endif
+    }
+    dma_backend = backend;
+    dma_head = dma_queued = dma_active = 0;
+    if (dma_backend->setup) {
+        dma_backend->setup();
+    }
+}
+
+/*
+ * lcd_dma_write(x0, y0, x1, y1, buf, callback, arg)
+ *
+ * Queue the pixels in buf for the window x0..x1, y0..y1. The buffer
+ * has to stay put until the callback runs (or lcd_dma_wait() returns).
+ */
+int
+lcd_dma_write(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+              const uint16_t *buf, lcd_dma_callback cb, void *arg) {
+    if (buf == 0) {
+        return -1;
+    }
+    return dma_queue_xfer(x0, y0, x1, y1, buf, 0, cb, arg);
+}
+
+/*
+ * lcd_dma_fill(x0, y0, x1, y1, color, callback, arg)
+ *
+ * Queue a solid fill of the window x0..x1, y0..y1.
+ */
+int
+lcd_dma_fill(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1,
+             uint16_t color, lcd_dma_callback cb, void *arg) {
+    return dma_queue_xfer(x0, y0, x1, y1, 0, color, cb, arg);
+}
+
+/* Is anything still in flight or waiting? */
+int
+lcd_dma_busy(void) {
+    return dma_active || dma_queued;
+}
+
+/*
+ * lcd_dma_wait()
+ *
+ * Barrier, returns once every queued transfer has finished and the
+ * LCD is safe to talk to directly again.
+ */
+void
+lcd_dma_wait(void) {
+    while (lcd_dma_busy()) {
+        if (dma_backend->poll) {
+            dma_backend->poll();
+        }
+    }
+}
+
+#ifndef LCD_HOST
+extern volatile uint16_t *__lcd_data_address;
+
+/*
+ * The board backend. DMA2 is the only controller that can do memory
+ * to memory, stream 0 channel 0 is used. M2M requires the FIFO, so
+ * it is switched on with a half full threshold.
+ */
+static void
+stm32_dma_setup(void) {
+    rcc_peripheral_enable_clock(&RCC_AHB1ENR, RCC_AHB1ENR_DMA2EN);
+    nvic_enable_irq(NVIC_DMA2_STREAM0_IRQ);
+}
+
+static void
+stm32_dma_start(const uint16_t *src, uint16_t count, int inc) {
+    dma_stream_reset(DMA2, DMA_STREAM0);
+    dma_channel_select(DMA2, DMA_STREAM0, DMA_SxCR_CHSEL_0);
+    dma_set_transfer_mode(DMA2, DMA_STREAM0, DMA_SxCR_DIR_MEM_TO_MEM);
+    dma_set_priority(DMA2, DMA_STREAM0, DMA_SxCR_PL_HIGH);
+    dma_set_peripheral_size(DMA2, DMA_STREAM0, DMA_SxCR_PSIZE_16BIT);
+    dma_set_memory_size(DMA2, DMA_STREAM0, DMA_SxCR_MSIZE_16BIT);
+    if (inc) {
+        dma_enable_peripheral_increment_mode(DMA2, DMA_STREAM0);
+    } else {
+        dma_disable_peripheral_increment_mode(DMA2, DMA_STREAM0);
+    }
+    dma_disable_memory_increment_mode(DMA2, DMA_STREAM0);
+    dma_enable_fifo_mode(DMA2, DMA_STREAM0);
+    dma_set_fifo_threshold(DMA2, DMA_STREAM0, DMA_SxFCR_FTH_2_4_FULL);
+    dma_set_peripheral_address(DMA2, DMA_STREAM0, (uint32_t) src);
+    dma_set_memory_address(DMA2, DMA_STREAM0, (uint32_t) __lcd_data_address);
+    dma_set_number_of_data(DMA2, DMA_STREAM0, count);
+    dma_enable_transfer_complete_interrupt(DMA2, DMA_STREAM0);
+    dma_enable_stream(DMA2, DMA_STREAM0);
+}
+
+void dma2_stream0_isr(void);
+
+void
+dma2_stream0_isr(void) {
+    if (dma_get_interrupt_flag(DMA2, DMA_STREAM0, DMA_TCIF)) {
+        dma_clear_interrupt_flags(DMA2, DMA_STREAM0, DMA_TCIF);
+        lcd_dma_done();
+    }
+}
+
+const struct lcd_dma_backend lcd_stm32_dma = {
+    stm32_dma_setup,
+    stm32_dma_start,
+    0
+};
+#endif
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2013 Chuck McManis (cmcmanis@mcmanis.com)
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ */
+
+/*
+ * Include file for the DMA pixel streaming engine (lcd_dma.c)
+ */
+#ifndef LCD_DMA_H
+#define LCD_DMA_H
+#include <stdint.h>
+
+/* How many transfers can be waiting at once */
+#ifndef LCD_DMA_QUEUE_LEN
+#define LCD_DMA_QUEUE_LEN   8
+#endif
+
+/* Largest single DMA transfer (NDTR is 16 bits) */
+#define LCD_DMA_MAX_CHUNK   65535
+
+typedef void (*lcd_dma_callback)(void *);
+
+/*
+ * What the engine needs from a DMA controller. start() moves count
+ * half words from src to the LCD data port (stepping src only if inc
+ * is set) and must call lcd_dma_done() once they are all out. poll()
+ * is for backends that are not interrupt driven (the host simulation),
+ * it is called while someone is waiting on the engine.
+ */
+struct lcd_dma_backend {
+    void    (*setup)(void);
+    void    (*start)(const uint16_t *src, uint16_t count, int inc);
+    void    (*poll)(void);
+};
+
+/*
+ * lcd_dma_write() and lcd_dma_fill() return 0 once the transfer is
+ * queued, waiting for room if the queue is full, or -1 if the window
+ * is empty. A callback may queue more transfers, but it runs from the
+ * completion interrupt and can't wait: if the queue is full there it
+ * gets -1 and the transfer is not queued.
+ */
+void lcd_dma_init(const struct lcd_dma_backend *);
+int lcd_dma_write(uint16_t, uint16_t, uint16_t, uint16_t, const uint16_t *,
+                  lcd_dma_callback, void *);
+int lcd_dma_fill(uint16_t, uint16_t, uint16_t, uint16_t, uint16_t,
+                 lcd_dma_callback, void *);
+int lcd_dma_busy(void);
+void lcd_dma_wait(void);
+void lcd_dma_done(void);
+
+#ifdef LCD_HOST
+extern const struct lcd_dma_backend lcd_emu_dma;
+#else
+extern const struct lcd_dma_backend lcd_stm32_dma;
+#endif
+
+#endif
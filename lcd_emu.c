@@ -0,0 +1,319 @@
+/*
+ * Copyright (C) 2013 Chuck McManis (cmcmanis@mcmanis.com)
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ */
+
+/*
+ * lcd_emu.c - a software SSD2119 for host builds
+ *
+ * When lcd.c is built with LCD_HOST every cycle it would have put on
+ * the FSMC (a write with DC low, a write with DC high, or a read) is
+ * handed to this module instead. It keeps the same state the real
+ * controller does: an index register selected by command writes, the
+ * register file, the GRAM and the X/Y address counter. Data written to
+ * RAM_DATA lands in the GRAM at the counter which then steps through
+ * the window set by H_RAM_START, H_RAM_END and V_RAM_POS just like the
+ * panel does, so the windowed burst code can be checked pixel for
+ * pixel on a PC.
+ *
+ * What is modelled:
+ *   - the index register, set by any write with DC low
+ *   - every register as a plain 16 bit value, readable back
+ *   - X_RAM_ADDR / Y_RAM_ADDR loading the address counter
+ *   - RAM_DATA writes and reads stepping the counter through the
+ *     window, in the order ENTRY_MODE asks for (AM picks horizontal or
+ *     vertical first, ID0/ID1 pick increment or decrement)
+ *   - the dummy read: the first GRAM read after RAM_DATA is selected
+ *     returns junk and doesn't move the counter, as on the real part
+ *
+ * What isn't: timing, power and gamma settings (they are just stored),
+ * and OUTPUT_CTRL (the dump is GRAM as addressed, not as the panel
+ * scans it out).
+ *
+ * The GRAM can be written out as a PPM (P6, viewable with nearly
+ * anything) or as raw little endian RGB565, and the bus traffic is
+ * counted so drawing code can be compared by the number of cycles it
+ * costs.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "lcd.h"
+#include "lcd_emu.h"
+#include "lcd_dma.h"
+
+static uint16_t emu_gram[LCD_DISPLAY_HEIGHT][LCD_DISPLAY_WIDTH];
+static uint16_t emu_regs[256];
+static uint8_t  emu_index;
+static uint16_t emu_x, emu_y;
+static int      emu_dummy;          /* next GRAM read is the dummy one */
+static struct lcd_emu_stats emu_stats;
+
+/*
+ * lcd_emu_reset()
+ *
+ * Put the model in its power on state, registers at their data sheet
+ * defaults (the ones the driver depends on anyway) and a black GRAM.
+ */
+void
+lcd_emu_reset(void) {
+    memset(emu_gram, 0, sizeof(emu_gram));
+    memset(emu_regs, 0, sizeof(emu_regs));
+    emu_regs[DEVICE_CODE_READ] = 0x9919;
+    emu_regs[ENTRY_MODE] = LCD_ENTRY_MODE_DEFAULT;
+    emu_regs[V_RAM_POS] = (LCD_DISPLAY_HEIGHT - 1) << 8;
+    emu_regs[H_RAM_START] = 0;
+    emu_regs[H_RAM_END] = LCD_DISPLAY_WIDTH - 1;
+    emu_index = 0;
+    emu_x = emu_y = 0;
+    emu_dummy = 0;
+    memset(&emu_stats, 0, sizeof(emu_stats));
+}
+
+/*
+ * Step one counter within [start, end], returns 1 when it wrapped
+ * (which is the cue to step the other one).
+ */
+static int
+emu_step(uint16_t *ac, uint16_t start, uint16_t end, int inc) {
+    if (inc) {
+        if (*ac >= end) {
+            *ac = start;
+            return 1;
+        }
+        (*ac)++;
+    } else {
+        if (*ac <= start) {
+            *ac = end;
+            return 1;
+        }
+        (*ac)--;
+    }
+    return 0;
+}
+
+/*
+ * Move the address counter on after a GRAM access. The counter should
+ * never be outside the window when this happens, if it is the driver
+ * forgot to set something up and that gets counted.
+ */
+static void
+emu_advance(void) {
+    uint16_t mode = emu_regs[ENTRY_MODE];
+    uint16_t hsa = emu_regs[H_RAM_START] & 0x1ff;
+    uint16_t hea = emu_regs[H_RAM_END] & 0x1ff;
+    uint16_t vsa = emu_regs[V_RAM_POS] & 0xff;
+    uint16_t vea = emu_regs[V_RAM_POS] >> 8;
+
+    if ((emu_x < hsa) || (emu_x > hea) || (emu_y < vsa) || (emu_y > vea)) {
+        emu_stats.outside++;
+    }
+    if (mode & LCD_ENTRY_AM) {
+        if (emu_step(&emu_y, vsa, vea, mode & LCD_ENTRY_ID1)) {
+            emu_step(&emu_x, hsa, hea, mode & LCD_ENTRY_ID0);
+        }
+    } else {
+        if (emu_step(&emu_x, hsa, hea, mode & LCD_ENTRY_ID0)) {
+            emu_step(&emu_y, vsa, vea, mode & LCD_ENTRY_ID1);
+        }
+    }
+}
+
+/* A bus write with DC low, selects the register for what follows */
+void
+lcd_emu_write_cmd(uint16_t cmd) {
+    emu_stats.cmd_writes++;
+    emu_index = (uint8_t) cmd;
+    emu_dummy = (emu_index == RAM_DATA);
+}
+
+/* A bus write with DC high */
+void
+lcd_emu_write_data(uint16_t val) {
+    emu_stats.data_writes++;
+    switch (emu_index) {
+        case RAM_DATA:
+            if ((emu_x < LCD_DISPLAY_WIDTH) && (emu_y < LCD_DISPLAY_HEIGHT)) {
+                emu_gram[emu_y][emu_x] = val;
+                emu_stats.gram_writes++;
+            }
+            emu_advance();
+            return;
+        case X_RAM_ADDR:
+            emu_x = val & 0x1ff;
+            emu_dummy = 1;
+            break;
+        case Y_RAM_ADDR:
+            emu_y = val & 0xff;
+            emu_dummy = 1;
+            break;
+        default:
+            break;
+    }
+    emu_regs[emu_index] = val;
+}
+
+/* A bus read */
+uint16_t
+lcd_emu_read_data(void) {
+    uint16_t result;
+
+    emu_stats.reads++;
+    if (emu_index != RAM_DATA) {
+        return emu_regs[emu_index];
+    }
+    if (emu_dummy) {
+        emu_dummy = 0;
+        return 0xdead;
+    }
+    result = 0;
+    if ((emu_x < LCD_DISPLAY_WIDTH) && (emu_y < LCD_DISPLAY_HEIGHT)) {
+        result = emu_gram[emu_y][emu_x];
+    }
+    emu_advance();
+    return result;
+}
+
+/* Peek at a GRAM location without touching the model's state */
+uint16_t
+lcd_emu_pixel(uint16_t x, uint16_t y) {
+    if ((x >= LCD_DISPLAY_WIDTH) || (y >= LCD_DISPLAY_HEIGHT)) {
+        return 0;
+    }
+    return emu_gram[y][x];
+}
+
+/* Peek at a register */
+uint16_t
+lcd_emu_reg(uint8_t reg) {
+    return emu_regs[reg];
+}
+
+/* Where the address counter is right now */
+void
+lcd_emu_counter(uint16_t *x, uint16_t *y) {
+    *x = emu_x;
+    *y = emu_y;
+}
+
+/*
+ * lcd_emu_stats(s, reset)
+ *
+ * Copy out the bus counters, and zero them if reset is set.
+ */
+void
+lcd_emu_stats(struct lcd_emu_stats *s, int reset) {
+    if (s) {
+        *s = emu_stats;
+    }
+    if (reset) {
+        memset(&emu_stats, 0, sizeof(emu_stats));
+    }
+}
+
+/*
+ * lcd_emu_dump_ppm(path)
+ *
+ * Write the GRAM out as a binary PPM, RGB565 widened to 8 bits per
+ * channel. Returns 0, or -1 if the file couldn't be written.
+ */
+int
+lcd_emu_dump_ppm(const char *path) {
+    FILE *f;
+    uint16_t x, y, p;
+    uint8_t rgb[3];
+
+    f = fopen(path, "wb");
+    if (f == NULL) {
+        return -1;
+    }
+    fprintf(f, "P6\n%d %d\n255\n", LCD_DISPLAY_WIDTH, LCD_DISPLAY_HEIGHT);
+    for (y = 0; y < LCD_DISPLAY_HEIGHT; y++) {
+        for (x = 0; x < LCD_DISPLAY_WIDTH; x++) {
+            p = emu_gram[y][x];
+            rgb[0] = ((p >> 11) & 0x1f) << 3;
+            rgb[1] = ((p >> 5) & 0x3f) << 2;
+            rgb[2] = (p & 0x1f) << 3;
+            rgb[0] |= rgb[0] >> 5;
+            rgb[1] |= rgb[1] >> 6;
+            rgb[2] |= rgb[2] >> 5;
+            fwrite(rgb, 1, 3, f);
+        }
+    }
+    return (fclose(f) == 0) ? 0 : -1;
+}
+
+/*
+ * lcd_emu_dump_raw(path)
+ *
+ * Write the GRAM out as it is, 320 x 240 little endian RGB565 words a
+ * line at a time, handy for comparing two runs with cmp(1).
+ */
+int
+lcd_emu_dump_raw(const char *path) {
+    FILE *f;
+    uint16_t x, y;
+    uint8_t b[2];
+
+    f = fopen(path, "wb");
+    if (f == NULL) {
+        return -1;
+    }
+    for (y = 0; y < LCD_DISPLAY_HEIGHT; y++) {
+        for (x = 0; x < LCD_DISPLAY_WIDTH; x++) {
+            b[0] = emu_gram[y][x] & 0xff;
+            b[1] = emu_gram[y][x] >> 8;
+            fwrite(b, 1, 2, f);
+        }
+    }
+    return (fclose(f) == 0) ? 0 : -1;
+}
+
+/*
+ * A stand in for the DMA controller (see lcd_dma.c). start() only
+ * latches the request, the data moves a few half words at a time each
+ * time the engine polls us, which is enough to have transfers overlap
+ * with whatever the caller does in between.
+ */
+#define EMU_DMA_BURST   64
+
+static const uint16_t *emu_dma_src;
+static uint16_t emu_dma_count;
+static int emu_dma_inc;
+
+static void
+emu_dma_start(const uint16_t *src, uint16_t count, int inc) {
+    emu_dma_src = src;
+    emu_dma_count = count;
+    emu_dma_inc = inc;
+}
+
+static void
+emu_dma_poll(void) {
+    int n;
+
+    if (emu_dma_count == 0) {
+        return;
+    }
+    for (n = 0; (n < EMU_DMA_BURST) && emu_dma_count; n++) {
+        lcd_emu_write_data(*emu_dma_src);
+        if (emu_dma_inc) {
+            emu_dma_src++;
+        }
+        emu_dma_count--;
+    }
+    if (emu_dma_count == 0) {
+        lcd_dma_done();
+    }
+}
+
+const struct lcd_dma_backend lcd_emu_dma = {
+    0,
+    emu_dma_start,
+    emu_dma_poll
+};
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2013 Chuck McManis (cmcmanis@mcmanis.com)
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ */
+
+/*
+ * Include file for the host (LCD_HOST) model of the SSD2119
+ */
+#ifndef LCD_EMU_H
+#define LCD_EMU_H
+#include <stdint.h>
+
+/* bus traffic seen by the model since the last reset */
+struct lcd_emu_stats {
+    uint32_t cmd_writes;        /* writes with DC low */
+    uint32_t data_writes;       /* writes with DC high */
+    uint32_t reads;
+    uint32_t gram_writes;       /* data writes that landed in GRAM */
+    uint32_t outside;           /* GRAM accesses with the counter outside
+                                   the window (a driver bug) */
+};
+
+void lcd_emu_reset(void);
+void lcd_emu_write_cmd(uint16_t);
+void lcd_emu_write_data(uint16_t);
+uint16_t lcd_emu_read_data(void);
+uint16_t lcd_emu_pixel(uint16_t, uint16_t);
+uint16_t lcd_emu_reg(uint8_t);
+void lcd_emu_counter(uint16_t *, uint16_t *);
+void lcd_emu_stats(struct lcd_emu_stats *, int);
+int lcd_emu_dump_ppm(const char *);
+int lcd_emu_dump_raw(const char *);
+
+#endif
@@ -0,0 +1,265 @@
+/*
+ * Copyright (C) 2013 Chuck McManis (cmcmanis@mcmanis.com)
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ */
+
+/*
+ * mkfont.c - compile the source fonts into gfx_fonts.c
+ *
+ *      mkfont > gfx_fonts.c
+ *
+ * (make -f Makefile.host fonts). This runs on the host, not the board.
+ * The source fonts are each in their own layout: font-7x12.c is 9
+ * rows of 7 bits with a flag for glyphs that descend, font-5x7.c is
+ * Adafruit's 5 columns of 8 bits. gfx.c doesn't read either of them,
+ * it gets a struct gfx_font (gfx.h) for each font with the glyphs
+ * converted to one layout, the order the panel is written in:
+ *
+ *  - rows[]: for each glyph, a byte per line of the cell from the top,
+ *    bit 7 is the leftmost pixel. Descenders are already moved down
+ *    and the spacing column and line are in the cell too, so drawing a
+ *    glyph is just walking its bytes.
+ *
+ *  - runs[]: the glyph's set pixels as horizontal runs, with a run that
+ *    repeats on the lines below merged into it, so each one is a
+ *    rectangle, packed into 16 bits as
+ *
+ *      (row << 12) | (column << 8) | (length << 4) | height
+ *
+ *    Transparent text is drawn from these, a fill per run, and blank
+ *    rows and columns cost nothing. Glyph c's runs are
+ *    runs[runs_index[c - first]] up to runs[runs_index[c - first + 1]].
+ *
+ *  - aa[]: an anti-aliased copy of the glyph, 2 bits a pixel (0 is all
+ *    background, 3 all foreground), a 16 bit word per line with the
+ *    leftmost pixel in the top two bits. It is made by scaling the
+ *    glyph up 2x with EPX (which rounds off the staircase corners) and
+ *    averaging each 2 x 2 block back down to one pixel.
+ *
+ * To add a font, include its source below, describe it in fonts[] and
+ * add it to the list in gfx.h.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "font-7x12.c"
+#undef FONT_CHAR_WIDTH
+#undef FONT_CHAR_HEIGHT
+#include "font-5x7.c"
+
+#define MAX_RUNS    64
+
+struct font {
+    const char  *name;      /* the descriptor is gfx_font_<name> */
+    int         width, height;      /* the cell, with spacing */
+    int         baseline;   /* lines above the baseline */
+    int         first, last;
+    int         (*bit)(int c, int col, int row);
+};
+
+/* 7 x 12: 9 rows of 7 bits, a descender drops the glyph 3 rows */
+static int
+mcm_bit(int c, int col, int row) {
+    const unsigned char *g = &mcm_font[c * 9];
+
+    if (*g & 0x80) {
+        row -= 3;
+    }
+    if ((row < 0) || (row > 8) || (col == 0)) {
+        return 0;
+    }
+    return (g[row] & (0x80 >> col)) != 0;
+}
+
+/* 5 x 7 (Adafruit's): a byte per column, bit 0 is the top row */
+static int
+font5x7_bit(int c, int col, int row) {
+    if (col > 4) {
+        return 0;
+    }
+    return (font_data[c * 5 + col] >> row) & 1;
+}
+
+static const struct font fonts[] = {
+    { "7x12", 8, 12, 9, 0, 127, mcm_bit },
+    { "5x7", 6, 8, 7, 0, sizeof(font_data) / 5 - 1, font5x7_bit },
+};
+
+#define NFONTS  (sizeof(fonts) / sizeof(fonts[0]))
+
+/*
+ * Find the runs of glyph c. Each row is cut into runs of set pixels;
+ * a run that matches one still open from the row above (same column
+ * and length) makes that one taller instead of starting a new one.
+ */
+static int
+glyph_runs(const struct font *f, int c, uint16_t *runs) {
+    int row, col, len, i, n = 0;
+    int open[MAX_RUNS];     /* runs that reached the row above */
+    int next[MAX_RUNS];
+    int nopen = 0, nnext;
+
+    for (row = 0; row < f->height; row++) {
+        nnext = 0;
+        for (col = 0; col < f->width; col += len) {
+            len = 1;
+            if (! f->bit(c, col, row)) {
+                continue;
+            }
+            while ((col + len < f->width) && f->bit(c, col + len, row)) {
+                len++;
+            }
+            for (i = 0; i < nopen; i++) {
+                if ((((runs[open[i]] >> 8) & 0xf) == col) &&
+                    (((runs[open[i]] >> 4) & 0xf) == len)) {
+                    break;
+                }
+            }
+            if (i < nopen) {
+                runs[open[i]]++;
+                next[nnext++] = open[i];
+            } else {
+                runs[n] = (uint16_t) ((row << 12) | (col << 8) | (len << 4) | 1);
+                next[nnext++] = n++;
+            }
+        }
+        for (i = 0; i < nnext; i++) {
+            open[i] = next[i];
+        }
+        nopen = nnext;
+    }
+    return n;
+}
+
+/* Pixel of glyph c, 0 outside the cell */
+static int
+cell_bit(const struct font *f, int c, int col, int row) {
+    if ((col < 0) || (row < 0) || (col >= f->width) || (row >= f->height)) {
+        return 0;
+    }
+    return f->bit(c, col, row);
+}
+
+/*
+ * How much of pixel col, row of glyph c is covered, 0 to 3. EPX turns
+ * the pixel into four, each of which takes the color of the two
+ * neighbours on its side if they agree (and the other two don't).
+ */
+static int
+aa_level(const struct font *f, int c, int col, int row) {
+    int p = cell_bit(f, c, col, row);
+    int a = cell_bit(f, c, col, row - 1);   /* above */
+    int b = cell_bit(f, c, col + 1, row);   /* right */
+    int l = cell_bit(f, c, col - 1, row);   /* left */
+    int d = cell_bit(f, c, col, row + 1);   /* below */
+    int q = 0;
+
+    q += ((l == a) && (l != d) && (a != b)) ? a : p;
+    q += ((a == b) && (a != l) && (b != d)) ? b : p;
+    q += ((d == l) && (d != b) && (l != a)) ? l : p;
+    q += ((b == d) && (b != a) && (d != l)) ? d : p;
+    /* quarters to levels, 2 of 4 rounds up */
+    return (q * 3 + 2) / 4;
+}
+
+static void
+emit_font(const struct font *f) {
+    uint16_t runs[MAX_RUNS];
+    int c, i, n, row, col, bits, total = 0;
+    int glyphs = f->last - f->first + 1;
+
+    printf("/* %s, %d x %d cells */\n", f->name, f->width, f->height);
+    printf("static const uint8_t font_%s_rows[%d] = {\n", f->name,
+           glyphs * f->height);
+    for (c = f->first; c <= f->last; c++) {
+        printf("   ");
+        for (row = 0; row < f->height; row++) {
+            bits = 0;
+            for (col = 0; col < f->width; col++) {
+                bits |= f->bit(c, col, row) << (7 - col);
+            }
+            printf(" 0x%02x,", bits);
+        }
+        printf("   // %d\n", c);
+    }
+    printf("};\n\n");
+
+    printf("static const uint16_t font_%s_runs_index[%d] = {", f->name,
+           glyphs + 1);
+    for (c = f->first; c <= f->last + 1; c++) {
+        printf("%s%4d,", ((c - f->first) % 10) ? " " : "\n   ", total);
+        if (c <= f->last) {
+            total += glyph_runs(f, c, runs);
+        }
+    }
+    printf("\n};\n\n");
+
+    printf("static const uint16_t font_%s_runs[%d] = {\n", f->name, total);
+    for (c = f->first; c <= f->last; c++) {
+        n = glyph_runs(f, c, runs);
+        if (n == 0) {
+            continue;
+        }
+        printf("   ");
+        for (i = 0; i < n; i++) {
+            printf(" 0x%04x,", runs[i]);
+        }
+        printf("   // %d\n", c);
+    }
+    printf("};\n\n");
+
+    printf("static const uint16_t font_%s_aa[%d] = {\n", f->name,
+           glyphs * f->height);
+    for (c = f->first; c <= f->last; c++) {
+        printf("   ");
+        for (row = 0; row < f->height; row++) {
+            bits = 0;
+            for (col = 0; col < f->width; col++) {
+                bits |= aa_level(f, c, col, row) << (14 - 2 * col);
+            }
+            printf(" 0x%04x,", bits);
+        }
+        printf("   // %d\n", c);
+    }
+    printf("};\n\n");
+
+    printf("const struct gfx_font gfx_font_%s = {\n", f->name);
+    printf("    \"%s\", %d, %d, %d, %d, %d, %d,\n", f->name,
+           (int) (f - fonts), f->width, f->height, f->baseline, f->first,
+           f->last);
+    printf("    font_%s_rows, font_%s_runs_index, font_%s_runs, font_%s_aa\n",
+           f->name, f->name, f->name, f->name);
+    printf("};\n\n");
+}
+
+int
+main(void) {
+    unsigned int i;
+
+    for (i = 0; i < NFONTS; i++) {
+        if ((fonts[i].width > 8) || (fonts[i].height > 15)) {
+            fprintf(stderr, "mkfont: %s is too big\n", fonts[i].name);
+            return 1;
+        }
+    }
+    printf("/*\n");
+    printf(" * gfx_fonts.c - generated by mkfont (mkfont.c) from the source fonts,\n");
+    printf(" * don't edit. Rebuild it with make -f Makefile.host fonts.\n");
+    printf(" */\n\n");
+    printf("#include <stdint.h>\n");
+    printf("#include \"gfx.h\"\n\n");
+    for (i = 0; i < NFONTS; i++) {
+        emit_font(&fonts[i]);
+    }
+    printf("const struct gfx_font *const gfx_fonts[GFX_FONTS] = {\n");
+    for (i = 0; i < NFONTS; i++) {
+        printf("    &gfx_font_%s,\n", fonts[i].name);
+    }
+    printf("};\n");
+    return 0;
+}
@@ -0,0 +1,219 @@
+/*
+ * Copyright (C) 2013 Chuck McManis (cmcmanis@mcmanis.com)
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ */
+
+/*
+ * prof.c - profiling scopes, see prof.h
+ *
+ * mtime() only has millisecond resolution which is about 20 glyphs,
+ * so this times with the Cortex-M4 cycle counter (DWT CYCCNT)
+ * instead: one tick is one 168 MHz clock. It wraps every 25 seconds,
+ * which is fine for anything worth timing this way. In a host build
+ * (LCD_HOST) a tick is a nanosecond of the monotonic clock.
+ *
+ * Each scope is a static structure (PROF_BEGIN makes it) that links
+ * itself on to a list the first time it runs. The scopes that are
+ * open sit on a small stack so a scope can tell its own time from
+ * the time spent in scopes nested inside it.
+ */
+
+#ifdef LCD_HOST
+#define _POSIX_C_SOURCE 199309L
+#include <time.h>
+#endif
+#include <stdint.h>
+#include <stddef.h>
+#include "util.h"
+#include "prof.h"
+
+#ifdef PROF
+#ifdef LCD_HOST
+#define PROF_UNITS  "ns"
+
+uint32_t
+prof_ticks(void) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t) (now.tv_sec * 1000000000ULL + now.tv_nsec);
+}
+
+void
+prof_init(void) {
+}
+#else
+#define PROF_UNITS  "cycles"
+
+/* Debug and trace registers (the libopencm3 ones move around) */
+#define DEMCR       (*(volatile uint32_t *)(0xE000EDFC))
+#define DWT_CTRL    (*(volatile uint32_t *)(0xE0001000))
+#define DWT_CYCCNT  (*(volatile uint32_t *)(0xE0001004))
+#define DEMCR_TRCENA        (1 << 24)
+#define DWT_CTRL_CYCCNTENA  (1 << 0)
+
+uint32_t
+prof_ticks(void) {
+    return DWT_CYCCNT;
+}
+
+/* Turn on the trace block and start the cycle counter */
+void
+prof_init(void) {
+    DEMCR |= DEMCR_TRCENA;
+    DWT_CYCCNT = 0;
+    DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+}
+#endif
+
+/* the scopes that are open */
+static struct {
+    struct prof_scope   *scope;
+    uint32_t            start;
+    uint32_t            nested;     /* ticks spent in scopes inside it */
+} prof_stack[PROF_DEPTH];
+
+static uint8_t prof_depth;
+static uint8_t prof_running;
+static uint32_t prof_errors;        /* unbalanced or too deep */
+static struct prof_scope *prof_list;   /* in the order they first ran */
+static struct prof_scope *prof_tail;
+
+void
+prof_begin(struct prof_scope *s) {
+    if (! prof_running) {
+        prof_init();
+        prof_running = 1;
+    }
+    if (prof_depth >= PROF_DEPTH) {
+        prof_errors++;
+        prof_depth++;
+        return;
+    }
+    if ((s->next == NULL) && (s != prof_tail)) {
+        if (prof_tail) {
+            prof_tail->next = s;
+        } else {
+            prof_list = s;
+        }
+        prof_tail = s;
+        s->depth = prof_depth;
+    }
+    prof_stack[prof_depth].scope = s;
+    prof_stack[prof_depth].nested = 0;
+    prof_stack[prof_depth].start = prof_ticks();
+    prof_depth++;
+}
+
+void
+prof_end(struct prof_scope *s) {
+    uint32_t now = prof_ticks();
+    uint32_t t;
+
+    if (prof_depth == 0) {
+        prof_errors++;
+        return;
+    }
+    prof_depth--;
+    if ((prof_depth >= PROF_DEPTH) || (prof_stack[prof_depth].scope != s)) {
+        prof_errors++;
+        return;
+    }
+    t = now - prof_stack[prof_depth].start;
+    if ((s->count == 0) || (t < s->min)) {
+        s->min = t;
+    }
+    if (t > s->max) {
+        s->max = t;
+    }
+    s->count++;
+    s->total += t;
+    s->self += t - prof_stack[prof_depth].nested;
+    if (prof_depth > 0) {
+        prof_stack[prof_depth - 1].nested += t;
+    }
+}
+
+/* Forget the numbers (but not the scopes) */
+void
+prof_reset(void) {
+    struct prof_scope *s;
+
+    for (s = prof_list; s != NULL; s = s->next) {
+        s->count = 0;
+        s->min = s->max = 0;
+        s->total = s->self = 0;
+    }
+    prof_errors = 0;
+}
+
+/* Print v right justified in width columns */
+static void
+prof_col(uint32_t v, int width) {
+    char buf[12];
+    int i = sizeof(buf) - 1;
+
+    buf[i] = 0;
+    do {
+        buf[--i] = (char) (v % 10) + '0';
+        v /= 10;
+        width--;
+    } while (v && (i > 0));
+    while ((width-- > 0) && (i > 0)) {
+        buf[--i] = ' ';
+    }
+    uart_puts(&buf[i]);
+}
+
+/* Print s, indented by indent, padded out to width columns */
+static void
+prof_name(const char *s, int indent, int width) {
+    width -= indent;
+    while (indent-- > 0) {
+        uart_puts(" ");
+    }
+    uart_puts((char *) s);
+    while (*s++) {
+        width--;
+    }
+    while (width-- > 0) {
+        uart_puts(" ");
+    }
+}
+
+/*
+ * prof_dump()
+ *
+ * One line per scope, nested scopes indented under the ones they ran
+ * in. "self" is the mean without the time spent in nested scopes.
+ */
+void
+prof_dump(void) {
+    struct prof_scope *s;
+
+    uart_puts("scope                count       min       max      mean"
+              "      self\n");
+    for (s = prof_list; s != NULL; s = s->next) {
+        if (s->count == 0) {
+            continue;
+        }
+        prof_name(s->name, 2 * s->depth, 16);
+        prof_col(s->count, 10);
+        prof_col(s->min, 10);
+        prof_col(s->max, 10);
+        prof_col((uint32_t) (s->total / s->count), 10);
+        prof_col((uint32_t) (s->self / s->count), 10);
+        uart_puts("\n");
+    }
+    uart_puts("(times in " PROF_UNITS ")\n");
+    if (prof_errors) {
+        uart_puts("unbalanced or too deeply nested scopes: ");
+        prof_col(prof_errors, 0);
+        uart_puts("\n");
+    }
+}
+#endif
@@ -0,0 +1,62 @@
+/*
+ * Copyright (C) 2013 Chuck McManis (cmcmanis@mcmanis.com)
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ */
+
+/*
+ * Include file for the profiling scopes (prof.c)
+ *
+ * Wrap the code to be timed in PROF_BEGIN(name) and PROF_END(name),
+ * in the same block, with a name that is unique in that function:
+ *
+ *      PROF_BEGIN(glyph);
+ *      gfx_drawChar(x, y, c, fg, bg, 1);
+ *      PROF_END(glyph);
+ *
+ * Scopes can nest. prof_dump() prints the count, min, max and mean
+ * of each one on the UART. Only a build with PROF defined
+ * (make PROF=1) has any of this, otherwise the macros are empty.
+ */
+#ifndef PROF_H
+#define PROF_H
+#include <stdint.h>
+
+/* how deep scopes can nest */
+#ifndef PROF_DEPTH
+#define PROF_DEPTH  8
+#endif
+
+struct prof_scope {
+    const char  *name;
+    uint32_t    count;
+    uint32_t    min, max;       /* ticks, including nested scopes */
+    uint64_t    total;
+    uint64_t    self;           /* ticks not spent in nested scopes */
+    uint8_t     depth;          /* how deeply nested it first ran */
+    struct prof_scope *next;
+};
+
+void prof_init(void);
+void prof_begin(struct prof_scope *);
+void prof_end(struct prof_scope *);
+uint32_t prof_ticks(void);
+void prof_reset(void);
+void prof_dump(void);
+
+#ifdef PROF
+#define PROF_BEGIN(id) \
+    static struct prof_scope __prof_##id = { .name = #id }; \
+    prof_begin(&__prof_##id)
+#define PROF_END(id)    prof_end(&__prof_##id)
+#else
+#define PROF_BEGIN(id)
+#define PROF_END(id)
+#define prof_reset()
+#define prof_dump()
+#endif
+
+#endif
@@ -0,0 +1,80 @@
+/*
+ * Copyright (C) 2013 Chuck McManis (cmcmanis@mcmanis.com)
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.
+ *
+ */
+
+/*
+ * util_host.c - the parts of util.c the LCD code needs, for a host
+ * (LCD_HOST) build. Time comes from the monotonic clock and the
+ * "uart" is stdout.
+ *
+ * msleep() doesn't actually sleep, it moves the clock mtime() reports
+ * forward instead. Code paced by msleep() (the demo waits 5 seconds
+ * between screens) then runs flat out but still sees time pass the
+ * way it expects.
+ */
+
+#define _POSIX_C_SOURCE 199309L
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+#include "util.h"
+
+void
+clock_setup(void) {
+}
+
+void
+systick_setup(void) {
+}
+
+void
+led_setup(void) {
+}
+
+void
+uart_setup(int baud) {
+    (void) baud;
+}
+
+static uint32_t skipped;    /* milliseconds "slept" by msleep() */
+
+/* Milliseconds since the first call */
+uint32_t
+mtime(void) {
+    static struct timespec start;
+    struct timespec now;
+
+    if ((start.tv_sec == 0) && (start.tv_nsec == 0)) {
+        clock_gettime(CLOCK_MONOTONIC, &start);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return (uint32_t) ((now.tv_sec - start.tv_sec) * 1000 +
+                       (now.tv_nsec - start.tv_nsec) / 1000000) + skipped;
+}
+
+void
+msleep(uint32_t delay) {
+    skipped += delay;
+}
+
+/* There is no keyboard on the host, never a character waiting */
+char
+uart_getc(int wait) {
+    (void) wait;
+    return '\000';
+}
+
+void
+uart_putc(char c) {
+    putchar(c);
+}
+
+void
+uart_puts(char *s) {
+    fputs(s, stdout);
+}